@@ -0,0 +1,689 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <random>
+#include <string>
+#include <vector>
+
+#if defined(__linux__)
+#include <endian.h>
+#endif
+
+#if !defined(_WIN32)
+#include <arpa/inet.h>
+#endif
+
+#include <endian/big_endian.hpp>
+#include <endian/cpu_features.hpp>
+#include <endian/crc32c.hpp>
+#include <endian/float16.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/padded_stream_reader.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/stream_vbyte.hpp>
+#include <endian/stream_writer.hpp>
+#include <endian/swap_in_place.hpp>
+
+#include "harness.hpp"
+
+// The benchmarks sweep every value width and buffer size for both endian
+// types and write the results as JSON, either to stdout or to the file given
+// with --output. Use --filter to only run cases whose name contains a given
+// string, --sizes to override the buffer sizes and --min_time to change the
+// time spent on each case. Use --cpu_level to run the vectorized kernels at a
+// lower instruction set level than the CPU supports.
+
+namespace
+{
+// Helper to get the smallest unsigned type holding a Bytes-sized value
+template <uint8_t Bytes>
+struct value_type
+{
+    using type = typename std::conditional<
+        (Bytes <= 1), uint8_t,
+        typename std::conditional<
+            (Bytes <= 2), uint16_t,
+            typename std::conditional<(Bytes <= 4), uint32_t,
+                                      uint64_t>::type>::type>::type;
+};
+
+// The number of random values cycled through when writing
+const std::size_t table_size = 4096;
+
+// State shared by all cases
+struct context
+{
+    std::vector<uint8_t> source;
+    std::vector<uint8_t> destination;
+    std::vector<uint64_t> values[9];
+    std::vector<uint8_t> varints[9];
+    std::vector<uint32_t> integers[5];
+    std::vector<uint8_t> vbytes[5];
+    std::vector<float> floats;
+    std::vector<uint64_t> unpacked;
+};
+
+const char* endian_name(const endian::big_endian*)
+{
+    return "big_endian";
+}
+
+const char* endian_name(const endian::little_endian*)
+{
+    return "little_endian";
+}
+
+std::string case_name(const std::string& endian, const std::string& group,
+                      std::size_t width, std::size_t size, std::size_t offset)
+{
+    return endian + "/" + group + "/" + std::to_string(width) + "/" +
+           std::to_string(size) + "/" + (offset == 0 ? "aligned" : "unaligned");
+}
+
+benchmark::benchmark_case make_case(const std::string& endian,
+                                    const std::string& group,
+                                    std::size_t width, std::size_t size,
+                                    std::size_t offset,
+                                    std::function<void()> function)
+{
+    return {case_name(endian, group, width, size, offset),
+            group,
+            endian,
+            width,
+            size,
+            offset,
+            size / width,
+            function};
+}
+
+template <class EndianType, uint8_t Bytes>
+void add_width_cases(std::vector<benchmark::benchmark_case>& cases,
+                     context& ctx, std::size_t size, std::size_t offset)
+{
+    using type = typename value_type<Bytes>::type;
+    const std::string endian = endian_name((EndianType*)nullptr);
+    const std::size_t count = size / Bytes;
+    const uint64_t* values = ctx.values[Bytes].data();
+    uint8_t* source = ctx.source.data() + offset;
+    uint8_t* destination = ctx.destination.data() + offset;
+
+    cases.push_back(make_case(
+        endian, "put_bytes", Bytes, size, offset, [=]() {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                EndianType::template put_bytes<Bytes>(
+                    (type)values[i % table_size], destination + i * Bytes);
+            }
+        }));
+
+    cases.push_back(make_case(
+        endian, "get_bytes", Bytes, size, offset, [=]() {
+            type sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                sum ^= EndianType::template get_bytes<Bytes, type>(
+                    source + i * Bytes);
+            }
+            benchmark::do_not_optimize(sum);
+        }));
+
+    cases.push_back(make_case(
+        endian, "write_bytes", Bytes, size, offset, [=]() {
+            endian::stream_writer<EndianType> writer(destination, count * Bytes);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                writer.template write_bytes<Bytes>(
+                    (type)values[i % table_size]);
+            }
+        }));
+
+    cases.push_back(make_case(
+        endian, "read_bytes", Bytes, size, offset, [=]() {
+            endian::stream_reader<EndianType> reader(source, count * Bytes);
+            type sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                type value;
+                reader.template read_bytes<Bytes>(value);
+                sum ^= value;
+            }
+            benchmark::do_not_optimize(sum);
+        }));
+
+    // The source buffer has room for the padding after the values
+    cases.push_back(make_case(
+        endian, "read_bytes_padded", Bytes, size, offset, [=]() {
+            endian::padded_stream_reader<EndianType> reader(
+                source, count * Bytes, count * Bytes + endian::read_padding);
+            type sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                type value;
+                reader.template read_bytes<Bytes>(value);
+                sum ^= value;
+            }
+            benchmark::do_not_optimize(sum);
+        }));
+}
+
+template <class EndianType, class ValueType>
+void add_native_cases(std::vector<benchmark::benchmark_case>& cases,
+                      context& ctx, std::size_t size, std::size_t offset)
+{
+    const std::string endian = endian_name((EndianType*)nullptr);
+    const std::size_t width = sizeof(ValueType);
+    const std::size_t count = size / width;
+    const uint64_t* values = ctx.values[width].data();
+    uint8_t* source = ctx.source.data() + offset;
+    uint8_t* destination = ctx.destination.data() + offset;
+
+    cases.push_back(
+        make_case(endian, "put", width, size, offset, [=]() {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                EndianType::put((ValueType)values[i % table_size],
+                                destination + i * width);
+            }
+        }));
+
+    cases.push_back(
+        make_case(endian, "get", width, size, offset, [=]() {
+            ValueType sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                sum ^= EndianType::template get<ValueType>(source + i * width);
+            }
+            benchmark::do_not_optimize(sum);
+        }));
+
+    if (width == 1)
+    {
+        return;
+    }
+
+    // The array cases convert from and to an aligned host array
+    const ValueType* input = (const ValueType*)ctx.source.data();
+    ValueType* array = (ValueType*)ctx.destination.data();
+    cases.push_back(
+        make_case(endian, "put_array", width, size, offset, [=]() {
+            EndianType::put_array(input, count, destination);
+        }));
+
+    cases.push_back(
+        make_case(endian, "get_array", width, size, offset, [=]() {
+            EndianType::get_array(array, count, source);
+        }));
+}
+
+// The packed array cases unpack the stored Bytes-sized values to a host
+// array of ValueType and pack them back again
+template <class EndianType, uint8_t Bytes, class ValueType>
+void add_packed_cases(std::vector<benchmark::benchmark_case>& cases,
+                      context& ctx, std::size_t size, std::size_t offset)
+{
+    const std::string endian = endian_name((EndianType*)nullptr);
+    const std::size_t count = size / Bytes;
+    const uint8_t* source = ctx.source.data() + offset;
+    uint8_t* destination = ctx.destination.data() + offset;
+    ValueType* array = (ValueType*)ctx.unpacked.data();
+
+    cases.push_back(
+        make_case(endian, "get_bytes_array", Bytes, size, offset, [=]() {
+            EndianType::template get_bytes_array<Bytes>(array, count, source);
+        }));
+
+    cases.push_back(
+        make_case(endian, "put_bytes_array", Bytes, size, offset, [=]() {
+            EndianType::template put_bytes_array<Bytes>(array, count,
+                                                        destination);
+        }));
+}
+
+template <class EndianType>
+void add_endian_cases(std::vector<benchmark::benchmark_case>& cases,
+                      context& ctx, std::size_t size, std::size_t offset)
+{
+    add_width_cases<EndianType, 1>(cases, ctx, size, offset);
+    add_width_cases<EndianType, 2>(cases, ctx, size, offset);
+    add_width_cases<EndianType, 3>(cases, ctx, size, offset);
+    add_width_cases<EndianType, 4>(cases, ctx, size, offset);
+    add_width_cases<EndianType, 5>(cases, ctx, size, offset);
+    add_width_cases<EndianType, 6>(cases, ctx, size, offset);
+    add_width_cases<EndianType, 7>(cases, ctx, size, offset);
+    add_width_cases<EndianType, 8>(cases, ctx, size, offset);
+
+    add_native_cases<EndianType, uint8_t>(cases, ctx, size, offset);
+    add_native_cases<EndianType, uint16_t>(cases, ctx, size, offset);
+    add_native_cases<EndianType, uint32_t>(cases, ctx, size, offset);
+    add_native_cases<EndianType, uint64_t>(cases, ctx, size, offset);
+
+    add_packed_cases<EndianType, 3, int32_t>(cases, ctx, size, offset);
+    add_packed_cases<EndianType, 5, int64_t>(cases, ctx, size, offset);
+    add_packed_cases<EndianType, 6, int64_t>(cases, ctx, size, offset);
+    add_packed_cases<EndianType, 7, int64_t>(cases, ctx, size, offset);
+}
+
+// The varint cases encode and decode the table of Bytes-sized values
+template <uint8_t Bytes>
+void add_varint_cases(std::vector<benchmark::benchmark_case>& cases,
+                      context& ctx)
+{
+    using type = typename value_type<Bytes>::type;
+    const uint64_t* values = ctx.values[Bytes].data();
+    const uint8_t* source = ctx.varints[Bytes].data();
+    const std::size_t size = ctx.varints[Bytes].size();
+    uint8_t* destination = ctx.destination.data();
+
+    auto write = make_case("varint", "write_varint", Bytes, size, 0, [=]() {
+        endian::stream_writer<endian::big_endian> writer(destination, size);
+        for (std::size_t i = 0; i < table_size; ++i)
+        {
+            writer.write_varint((type)values[i]);
+        }
+    });
+    write.values = table_size;
+    cases.push_back(write);
+
+    auto read = make_case("varint", "read_varint", Bytes, size, 0, [=]() {
+        endian::stream_reader<endian::big_endian> reader(source, size);
+        type sum = 0;
+        for (std::size_t i = 0; i < table_size; ++i)
+        {
+            sum ^= reader.template read_varint<type>();
+        }
+        benchmark::do_not_optimize(sum);
+    });
+    read.values = table_size;
+    cases.push_back(read);
+}
+
+// The stream_vbyte cases encode and decode the table of Bytes-sized values
+template <uint8_t Bytes>
+void add_stream_vbyte_cases(std::vector<benchmark::benchmark_case>& cases,
+                            context& ctx)
+{
+    const uint32_t* values = ctx.integers[Bytes].data();
+    const uint8_t* source = ctx.vbytes[Bytes].data();
+    const std::size_t size = ctx.vbytes[Bytes].size();
+    uint8_t* destination = ctx.destination.data();
+    uint32_t* decoded = (uint32_t*)ctx.destination.data();
+
+    auto encode = make_case("stream_vbyte", "encode", Bytes, size, 0, [=]() {
+        endian::stream_vbyte::encode(values, table_size, destination);
+    });
+    encode.values = table_size;
+    cases.push_back(encode);
+
+    auto decode = make_case("stream_vbyte", "decode", Bytes, size, 0, [=]() {
+        endian::stream_vbyte::decode(source, table_size, decoded);
+    });
+    decode.values = table_size;
+    cases.push_back(decode);
+}
+
+// The in-place cases convert the destination buffer back and forth without
+// a second copy
+template <uint8_t Bytes>
+void add_swap_in_place_cases(std::vector<benchmark::benchmark_case>& cases,
+                             context& ctx, std::size_t size,
+                             std::size_t offset)
+{
+    const std::size_t count = size / Bytes;
+    uint8_t* destination = ctx.destination.data() + offset;
+
+    cases.push_back(
+        make_case("in_place", "swap_bytes_in_place", Bytes, size, offset,
+                  [=]() {
+                      endian::swap_bytes_in_place<Bytes>(destination, count);
+                  }));
+}
+
+// The half precision cases widen the stored values to floats and narrow
+// the floats back again
+template <class EndianType, class HalfType>
+void add_half_cases(std::vector<benchmark::benchmark_case>& cases,
+                    context& ctx, const std::string& name, std::size_t size,
+                    std::size_t offset)
+{
+    const std::string endian = endian_name((EndianType*)nullptr);
+    const std::size_t count = size / 2;
+    const uint8_t* source = ctx.source.data() + offset;
+    uint8_t* destination = ctx.destination.data() + offset;
+    float* floats = ctx.floats.data();
+
+    cases.push_back(make_case(endian, "widen_" + name, 2, size, offset, [=]() {
+        endian::get_widened_array<EndianType, HalfType>(floats, count, source);
+    }));
+
+    cases.push_back(
+        make_case(endian, "narrow_" + name, 2, size, offset, [=]() {
+            endian::put_narrowed_array<EndianType, HalfType>(floats, count,
+                                                             destination);
+        }));
+}
+
+// The checksum cases compute a CRC32C over the buffer in one pass, and
+// while writing and reading 32 bit values through the streams, to compare
+// with the unchecksummed write_bytes and read_bytes cases
+template <class EndianType>
+void add_checksum_cases(std::vector<benchmark::benchmark_case>& cases,
+                        context& ctx, std::size_t size, std::size_t offset)
+{
+    const std::string endian = endian_name((EndianType*)nullptr);
+    const std::size_t count = size / 4;
+    const uint64_t* values = ctx.values[4].data();
+    const uint8_t* source = ctx.source.data() + offset;
+    uint8_t* destination = ctx.destination.data() + offset;
+
+    cases.push_back(make_case(endian, "crc32c", 1, size, offset, [=]() {
+        benchmark::do_not_optimize(endian::crc32c(source, size));
+    }));
+
+    cases.push_back(
+        make_case(endian, "write_bytes_crc32c", 4, size, offset, [=]() {
+            endian::stream_writer<EndianType, endian::assert_check,
+                                  endian::crc32c_checksum>
+                writer(destination, count * 4);
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                writer.template write_bytes<4>(
+                    (uint32_t)values[i % table_size]);
+            }
+            benchmark::do_not_optimize(writer.checksum());
+        }));
+
+    cases.push_back(
+        make_case(endian, "read_bytes_crc32c", 4, size, offset, [=]() {
+            endian::stream_reader<EndianType, endian::assert_check,
+                                  endian::crc32c_checksum>
+                reader(source, count * 4);
+            uint32_t sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                uint32_t value;
+                reader.template read_bytes<4>(value);
+                sum ^= value;
+            }
+            benchmark::do_not_optimize(sum ^ reader.checksum());
+        }));
+}
+
+// Reference implementations the library is compared against
+void add_baseline_cases(std::vector<benchmark::benchmark_case>& cases,
+                        context& ctx, std::size_t size, std::size_t offset)
+{
+    const std::size_t count = size / 4;
+    const uint64_t* values = ctx.values[4].data();
+    uint8_t* source = ctx.source.data() + offset;
+    uint8_t* destination = ctx.destination.data() + offset;
+
+    cases.push_back(
+        make_case("baseline", "memcpy", 1, size, offset,
+                  [=]() { memcpy(destination, source, size); }));
+
+    cases.push_back(
+        make_case("baseline", "bswap_put", 4, size, offset, [=]() {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                uint32_t v = (uint32_t)values[i % table_size];
+                v = (v >> 24) | ((v >> 8) & 0x0000FF00U) |
+                    ((v << 8) & 0x00FF0000U) | (v << 24);
+                memcpy(destination + i * 4, &v, 4);
+            }
+        }));
+
+    cases.push_back(
+        make_case("baseline", "bswap_get", 4, size, offset, [=]() {
+            uint32_t sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                uint32_t v;
+                memcpy(&v, source + i * 4, 4);
+                sum ^= (v >> 24) | ((v >> 8) & 0x0000FF00U) |
+                       ((v << 8) & 0x00FF0000U) | (v << 24);
+            }
+            benchmark::do_not_optimize(sum);
+        }));
+
+#if !defined(_WIN32)
+    cases.push_back(
+        make_case("baseline", "htonl", 4, size, offset, [=]() {
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                uint32_t v = htonl((uint32_t)values[i % table_size]);
+                memcpy(destination + i * 4, &v, 4);
+            }
+        }));
+
+    cases.push_back(
+        make_case("baseline", "ntohl", 4, size, offset, [=]() {
+            uint32_t sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                uint32_t v;
+                memcpy(&v, source + i * 4, 4);
+                sum ^= ntohl(v);
+            }
+            benchmark::do_not_optimize(sum);
+        }));
+#endif
+
+#if defined(__linux__)
+    cases.push_back(
+        make_case("baseline", "be32toh", 4, size, offset, [=]() {
+            uint32_t sum = 0;
+            for (std::size_t i = 0; i < count; ++i)
+            {
+                uint32_t v;
+                memcpy(&v, source + i * 4, 4);
+                sum ^= be32toh(v);
+            }
+            benchmark::do_not_optimize(sum);
+        }));
+#endif
+}
+
+std::vector<std::size_t> parse_sizes(const std::string& list)
+{
+    std::vector<std::size_t> sizes;
+    std::size_t start = 0;
+    while (start < list.size())
+    {
+        std::size_t end = list.find(',', start);
+        if (end == std::string::npos)
+        {
+            end = list.size();
+        }
+        sizes.push_back(std::stoull(list.substr(start, end - start)));
+        start = end + 1;
+    }
+    return sizes;
+}
+
+std::string compiler()
+{
+#if defined(__clang__)
+    return std::string("clang ") + __clang_version__;
+#elif defined(__GNUC__)
+    return std::string("gcc ") + __VERSION__;
+#elif defined(_MSC_VER)
+    return "msvc " + std::to_string(_MSC_VER);
+#else
+    return "unknown";
+#endif
+}
+bool parse_cpu_level(const std::string& name, endian::cpu_level& level)
+{
+    for (int i = 0; i <= static_cast<int>(endian::cpu_level::avx512bw); ++i)
+    {
+        if (name == endian::cpu_level_name(static_cast<endian::cpu_level>(i)))
+        {
+            level = static_cast<endian::cpu_level>(i);
+            return true;
+        }
+    }
+    return false;
+}
+}
+
+int main(int argc, char** argv)
+{
+    // Buffer sizes fitting L1, L2, L3 and going to DRAM
+    std::vector<std::size_t> sizes = {16 * 1024, 256 * 1024, 4 * 1024 * 1024,
+                                      64 * 1024 * 1024};
+    std::string filter;
+    std::string output;
+    double min_time = 0.05;
+    endian::cpu_level level = endian::active_cpu_level();
+
+    for (int i = 1; i < argc; ++i)
+    {
+        std::string arg = argv[i];
+        if (arg.compare(0, 9, "--filter=") == 0)
+        {
+            filter = arg.substr(9);
+        }
+        else if (arg.compare(0, 9, "--output=") == 0)
+        {
+            output = arg.substr(9);
+        }
+        else if (arg.compare(0, 8, "--sizes=") == 0)
+        {
+            sizes = parse_sizes(arg.substr(8));
+        }
+        else if (arg.compare(0, 11, "--min_time=") == 0)
+        {
+            min_time = std::atof(arg.substr(11).c_str());
+        }
+        else if (arg.compare(0, 12, "--cpu_level=") == 0 &&
+                 parse_cpu_level(arg.substr(12), level))
+        {
+            endian::set_cpu_level(level);
+        }
+        else
+        {
+            std::cerr << "Usage: " << argv[0]
+                      << " [--filter=<substring>] [--output=<file>]"
+                      << " [--sizes=<bytes>,...] [--min_time=<seconds>]"
+                      << " [--cpu_level=scalar|sse2|ssse3|avx2|avx512bw]"
+                      << std::endl;
+            return 1;
+        }
+    }
+
+    std::cerr << "cpu_level: "
+              << endian::cpu_level_name(endian::active_cpu_level()) << " of "
+              << endian::cpu_level_name(endian::detected_cpu_level())
+              << std::endl;
+
+    std::size_t max_size = 0;
+    for (std::size_t size : sizes)
+    {
+        max_size = std::max(max_size, size);
+    }
+
+    // Room for the unaligned offset and the widest value
+    context ctx;
+    ctx.source.resize(max_size + 16);
+    ctx.destination.resize(max_size + 16);
+
+    std::mt19937_64 engine(42);
+    ctx.floats.resize(max_size / 2);
+    ctx.unpacked.resize(max_size / 4);
+    for (float& value : ctx.floats)
+    {
+        value = static_cast<float>(engine() % 200000) / 3.0f - 30000.0f;
+    }
+    for (uint8_t& byte : ctx.source)
+    {
+        byte = (uint8_t)engine();
+    }
+    for (std::size_t width = 1; width <= 8; ++width)
+    {
+        const uint64_t mask =
+            width == 8 ? ~0ULL : ((1ULL << (width * 8)) - 1);
+        ctx.values[width].resize(table_size);
+        for (uint64_t& value : ctx.values[width])
+        {
+            value = engine() & mask;
+        }
+
+        ctx.varints[width].resize(table_size * 10);
+        endian::stream_writer<endian::big_endian> writer(
+            ctx.varints[width].data(), ctx.varints[width].size());
+        for (uint64_t value : ctx.values[width])
+        {
+            writer.write_varint(value);
+        }
+        ctx.varints[width].resize(writer.position());
+
+        if (width <= 4)
+        {
+            ctx.integers[width].assign(ctx.values[width].begin(),
+                                       ctx.values[width].end());
+            ctx.vbytes[width].resize(
+                endian::stream_vbyte::max_encoded_size(table_size));
+            ctx.vbytes[width].resize(endian::stream_vbyte::encode(
+                ctx.integers[width].data(), table_size,
+                ctx.vbytes[width].data()));
+        }
+    }
+
+    std::vector<benchmark::benchmark_case> cases;
+    for (std::size_t size : sizes)
+    {
+        for (std::size_t offset : {0U, 1U})
+        {
+            add_baseline_cases(cases, ctx, size, offset);
+            add_endian_cases<endian::big_endian>(cases, ctx, size, offset);
+            add_endian_cases<endian::little_endian>(cases, ctx, size, offset);
+            add_swap_in_place_cases<2>(cases, ctx, size, offset);
+            add_swap_in_place_cases<3>(cases, ctx, size, offset);
+            add_swap_in_place_cases<4>(cases, ctx, size, offset);
+            add_swap_in_place_cases<8>(cases, ctx, size, offset);
+            add_half_cases<endian::big_endian, endian::float16>(
+                cases, ctx, "float16", size, offset);
+            add_half_cases<endian::big_endian, endian::bfloat16>(
+                cases, ctx, "bfloat16", size, offset);
+            add_checksum_cases<endian::big_endian>(cases, ctx, size, offset);
+        }
+    }
+    add_varint_cases<1>(cases, ctx);
+    add_varint_cases<2>(cases, ctx);
+    add_varint_cases<4>(cases, ctx);
+    add_varint_cases<8>(cases, ctx);
+    add_stream_vbyte_cases<1>(cases, ctx);
+    add_stream_vbyte_cases<2>(cases, ctx);
+    add_stream_vbyte_cases<4>(cases, ctx);
+
+    std::vector<benchmark::result> results;
+    for (const auto& bench : cases)
+    {
+        if (bench.name.find(filter) == std::string::npos)
+        {
+            continue;
+        }
+        results.push_back(benchmark::measure(bench, min_time, 3));
+        std::cerr << bench.name << ": " << results.back().best_ns / bench.values
+                  << " ns/value" << std::endl;
+    }
+
+    if (output.empty())
+    {
+        benchmark::write_json(std::cout, results, compiler());
+    }
+    else
+    {
+        std::ofstream file(output);
+        benchmark::write_json(file, results, compiler());
+    }
+
+    return 0;
+}
@@ -0,0 +1,146 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <ostream>
+#include <string>
+#include <vector>
+
+namespace benchmark
+{
+/// Prevents the compiler from optimizing away the computation of a value
+template <class ValueType>
+inline void do_not_optimize(const ValueType& value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static volatile ValueType sink;
+    sink = value;
+#endif
+}
+
+/// Prevents the compiler from assuming anything about memory
+inline void clobber_memory()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : : "memory");
+#endif
+}
+
+/// A single benchmark case. Each call of the function processes the given
+/// number of values, each being width bytes on the wire.
+struct benchmark_case
+{
+    std::string name;
+    std::string group;
+    std::string endian;
+    std::size_t width;
+    std::size_t size;
+    std::size_t offset;
+    std::size_t values;
+    std::function<void()> function;
+};
+
+/// The measured result of a benchmark case
+struct result
+{
+    const benchmark_case* bench;
+    uint64_t iterations;
+    double best_ns;
+    double mean_ns;
+};
+
+/// Runs a benchmark case repeatedly until min_time seconds have been spent
+/// and keeps the fastest and average iteration time.
+inline result measure(const benchmark_case& bench, double min_time,
+                      uint32_t min_iterations)
+{
+    using clock = std::chrono::steady_clock;
+
+    // Warm up caches and page tables
+    bench.function();
+
+    result r{&bench, 0, 0.0, 0.0};
+    double total_ns = 0.0;
+    double best_ns = 0.0;
+    const auto start = clock::now();
+    while (r.iterations < min_iterations ||
+           std::chrono::duration<double>(clock::now() - start).count() <
+               min_time)
+    {
+        const auto before = clock::now();
+        bench.function();
+        clobber_memory();
+        const auto after = clock::now();
+
+        const double ns =
+            std::chrono::duration<double, std::nano>(after - before).count();
+        best_ns = (r.iterations == 0) ? ns : std::min(best_ns, ns);
+        total_ns += ns;
+        ++r.iterations;
+    }
+    r.best_ns = best_ns;
+    r.mean_ns = total_ns / r.iterations;
+    return r;
+}
+
+/// Escapes a string for use in a JSON document
+inline std::string json_escape(const std::string& value)
+{
+    std::string escaped;
+    for (char c : value)
+    {
+        if (c == '"' || c == '\\')
+        {
+            escaped += '\\';
+        }
+        escaped += c;
+    }
+    return escaped;
+}
+
+/// Writes the results as a JSON document
+inline void write_json(std::ostream& out, const std::vector<result>& results,
+                       const std::string& compiler)
+{
+    out << "{\n";
+    out << "  \"context\": {\n";
+    out << "    \"compiler\": \"" << json_escape(compiler) << "\",\n";
+    out << "    \"timestamp\": "
+        << std::chrono::duration_cast<std::chrono::seconds>(
+               std::chrono::system_clock::now().time_since_epoch())
+               .count()
+        << "\n";
+    out << "  },\n";
+    out << "  \"benchmarks\": [";
+    for (std::size_t i = 0; i < results.size(); ++i)
+    {
+        const result& r = results[i];
+        const benchmark_case& b = *r.bench;
+        const double bytes = static_cast<double>(b.values * b.width);
+
+        out << (i == 0 ? "\n" : ",\n");
+        out << "    {\"name\": \"" << json_escape(b.name) << "\", ";
+        out << "\"group\": \"" << json_escape(b.group) << "\", ";
+        out << "\"endian\": \"" << json_escape(b.endian) << "\", ";
+        out << "\"width\": " << b.width << ", ";
+        out << "\"size\": " << b.size << ", ";
+        out << "\"offset\": " << b.offset << ", ";
+        out << "\"iterations\": " << r.iterations << ", ";
+        out << "\"best_ns\": " << r.best_ns << ", ";
+        out << "\"mean_ns\": " << r.mean_ns << ", ";
+        out << "\"ns_per_value\": " << r.best_ns / b.values << ", ";
+        out << "\"bytes_per_second\": " << bytes / (r.best_ns * 1e-9) << "}";
+    }
+    out << "\n  ]\n";
+    out << "}\n";
+}
+}
@@ -0,0 +1,167 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <endian/swap_in_place.hpp>
+
+// Converts a file of fixed-size records between big and little endian in
+// place. Every record is made up of the fields given by the width list, e.g.
+//
+//     sw_endian_convert data.bin 4,2,8
+//
+// converts records of a 32, a 16 and a 64 bit field. The file is mapped into
+// memory and each field is byte swapped where it is, so no second copy of the
+// file is made. Running the tool twice restores the original file.
+
+namespace
+{
+// The amount of data converted between read-ahead hints
+const std::size_t chunk_size = 64 * 1024 * 1024;
+
+bool parse_widths(const std::string& list, std::vector<uint8_t>& widths)
+{
+    std::size_t start = 0;
+    while (start <= list.size())
+    {
+        std::size_t end = list.find(',', start);
+        if (end == std::string::npos)
+        {
+            end = list.size();
+        }
+        const std::string item = list.substr(start, end - start);
+        char* last = nullptr;
+        const unsigned long width = std::strtoul(item.c_str(), &last, 10);
+        if (item.empty() || *last != '\0' || width == 0 || width > 8)
+        {
+            return false;
+        }
+        widths.push_back(static_cast<uint8_t>(width));
+        start = end + 1;
+    }
+    return !widths.empty();
+}
+}
+
+int main(int argc, char** argv)
+{
+    std::vector<uint8_t> widths;
+    if (argc != 3 || !parse_widths(argv[2], widths))
+    {
+        std::cerr << "Usage: " << argv[0] << " <file> <width>[,<width>...]"
+                  << std::endl;
+        std::cerr << "Each width is the size in bytes (1 to 8) of a field "
+                  << "of the records in the file." << std::endl;
+        return 1;
+    }
+
+    std::size_t record_size = 0;
+    for (uint8_t width : widths)
+    {
+        record_size += width;
+    }
+
+    const int fd = open(argv[1], O_RDWR);
+    if (fd < 0)
+    {
+        std::cerr << "Could not open " << argv[1] << ": " << strerror(errno)
+                  << std::endl;
+        return 1;
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0)
+    {
+        std::cerr << "Could not stat " << argv[1] << ": " << strerror(errno)
+                  << std::endl;
+        close(fd);
+        return 1;
+    }
+
+    const std::size_t size = static_cast<std::size_t>(info.st_size);
+    if (size % record_size != 0)
+    {
+        std::cerr << "The file size " << size << " is not a multiple of the "
+                  << "record size " << record_size << std::endl;
+        close(fd);
+        return 1;
+    }
+    if (size == 0)
+    {
+        close(fd);
+        return 0;
+    }
+
+    void* mapping =
+        mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (mapping == MAP_FAILED)
+    {
+        std::cerr << "Could not map " << argv[1] << ": " << strerror(errno)
+                  << std::endl;
+        close(fd);
+        return 1;
+    }
+    uint8_t* data = static_cast<uint8_t*>(mapping);
+
+    // The file is visited once from start to end, so ask the kernel for
+    // aggressive read-ahead
+    madvise(mapping, size, MADV_SEQUENTIAL);
+
+    const auto start = std::chrono::steady_clock::now();
+
+    // Convert whole records a chunk at a time, prefetching the next chunk
+    // while the current one is being converted
+    const std::size_t records = size / record_size;
+    const std::size_t chunk_records =
+        std::max<std::size_t>(chunk_size / record_size, 1);
+    const std::size_t page_size = sysconf(_SC_PAGESIZE);
+    for (std::size_t first = 0; first < records; first += chunk_records)
+    {
+        const std::size_t count = std::min(chunk_records, records - first);
+        uint8_t* chunk = data + first * record_size;
+
+        const std::size_t next = (first + count) * record_size;
+        if (next < size)
+        {
+            const std::size_t page = next / page_size * page_size;
+            madvise(data + page,
+                    std::min(chunk_size + next - page, size - page),
+                    MADV_WILLNEED);
+        }
+
+        endian::swap_records_in_place(chunk, count, widths);
+    }
+
+    if (munmap(mapping, size) != 0)
+    {
+        std::cerr << "Could not unmap " << argv[1] << ": " << strerror(errno)
+                  << std::endl;
+        close(fd);
+        return 1;
+    }
+    close(fd);
+
+    const double seconds = std::chrono::duration<double>(
+                               std::chrono::steady_clock::now() - start)
+                               .count();
+    std::cout << "Converted " << records << " records (" << size
+              << " bytes) in " << seconds << " s, "
+              << size / seconds / (1024.0 * 1024.0) << " MiB/s" << std::endl;
+
+    return 0;
+}
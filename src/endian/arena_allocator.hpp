@@ -0,0 +1,73 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#include "monotonic_arena.hpp"
+
+namespace endian
+{
+/// Standard allocator handing out memory from a monotonic_arena. Deallocation
+/// does nothing, the memory is reclaimed when the arena is reset. The arena
+/// must outlive every allocator and allocation using it.
+template <class ValueType>
+class arena_allocator
+{
+public:
+    using value_type = ValueType;
+
+    /// @param arena the arena to allocate from
+    explicit arena_allocator(monotonic_arena& arena) noexcept : m_arena(&arena)
+    {
+    }
+
+    /// Rebinding constructor used by containers
+    template <class OtherType>
+    arena_allocator(const arena_allocator<OtherType>& other) noexcept :
+        m_arena(&other.arena())
+    {
+    }
+
+    /// @param elements the number of elements to allocate
+    /// @return pointer to uninitialized memory for the elements
+    ValueType* allocate(std::size_t elements)
+    {
+        return static_cast<ValueType*>(
+            m_arena->allocate(elements * sizeof(ValueType), alignof(ValueType)));
+    }
+
+    /// Does nothing, the memory is reclaimed by monotonic_arena::reset()
+    void deallocate(ValueType*, std::size_t) noexcept
+    {
+    }
+
+    /// @return the arena used by this allocator
+    monotonic_arena& arena() const noexcept
+    {
+        return *m_arena;
+    }
+
+private:
+    /// The arena to allocate from
+    monotonic_arena* m_arena;
+};
+
+template <class T, class U>
+bool operator==(const arena_allocator<T>& a,
+                const arena_allocator<U>& b) noexcept
+{
+    return &a.arena() == &b.arena();
+}
+
+template <class T, class U>
+bool operator!=(const arena_allocator<T>& a,
+                const arena_allocator<U>& b) noexcept
+{
+    return !(a == b);
+}
+}
@@ -0,0 +1,21 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include "bytes_view.hpp"
+
+namespace endian
+{
+/// A read-only view of an array of full-width values, see bytes_view
+template <class EndianType, class ValueType>
+using array_view = bytes_view<EndianType, sizeof(ValueType), ValueType>;
+
+/// A view of an array of full-width values allowing changes, see
+/// mutable_bytes_view
+template <class EndianType, class ValueType>
+using mutable_array_view =
+    mutable_bytes_view<EndianType, sizeof(ValueType), ValueType>;
+}
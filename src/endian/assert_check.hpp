@@ -0,0 +1,44 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+
+namespace endian
+{
+/// Check policy for the stream_reader and stream_writer which asserts that
+/// every access stays within the underlying buffer. The checks are removed
+/// when NDEBUG is defined. This is the default policy.
+class assert_check
+{
+public:
+    /// True since this policy never throws
+    static constexpr bool is_noexcept = true;
+
+protected:
+    /// @param condition must be true for the access to be valid
+    /// @param message describing the failed check
+    /// @return always true, an invalid access aborts in debug builds
+    static bool check(bool condition, const char* message) noexcept
+    {
+        (void)condition;
+        (void)message;
+        assert(condition && "Access outside the underlying buffer");
+        return true;
+    }
+
+    /// @param condition must be true for the data to be well-formed
+    /// @param message describing the failed check
+    /// @return always true, malformed data aborts in debug builds
+    static bool check_format(bool condition, const char* message) noexcept
+    {
+        (void)condition;
+        (void)message;
+        assert(condition && "Malformed data in the underlying buffer");
+        return true;
+    }
+};
+}
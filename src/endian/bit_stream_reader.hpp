@@ -0,0 +1,208 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#include "assert_check.hpp"
+#include "detail/bit_order.hpp"
+
+namespace endian
+{
+/// The bit_stream_reader reads values of any number of bits, up to 64, from
+/// a fixed size buffer. With big_endian the bits are read from the most
+/// significant bit of each byte and values are stored most significant bit
+/// first, as in most network protocols. With little_endian the bits are read
+/// from the least significant bit of each byte and values are stored least
+/// significant bit first, as in e.g. DEFLATE.
+///
+/// The bits are read through a 64 bit register which is refilled with a
+/// single 8 byte load, so most reads are a shift and a mask.
+///
+/// Every read is bounds checked once according to the CheckPolicy. A read
+/// rejected by the policy leaves the stream unchanged and returns 0.
+template <typename EndianType, typename CheckPolicy = assert_check>
+class bit_stream_reader : public CheckPolicy
+{
+    using order = detail::bit_order<EndianType>;
+
+public:
+    /// Creates a bit stream on top of a buffer of the specified size.
+    ///
+    /// @param data a data pointer to the buffer
+    /// @param size the size of the buffer in bytes
+    bit_stream_reader(const uint8_t* data, std::size_t size) noexcept :
+        m_data(data), m_size(size)
+    {
+        assert((data != nullptr || size == 0) && "Nullpointer provided");
+    }
+
+    /// Reads a number of bits.
+    ///
+    /// @param count the number of bits to read, at most 64
+    /// @return the read bits as an unsigned value
+    uint64_t read_bits(uint32_t count) noexcept(CheckPolicy::is_noexcept)
+    {
+        assert(count <= 64 && "At most 64 bits can be read at once");
+
+        if (!this->check(count <= remaining_bits(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return 0;
+        }
+
+        // A refill guarantees at least 57 bits, so wider values are read
+        // in two parts
+        if (count > 56)
+        {
+            if (order::is_msb_first)
+            {
+                const uint64_t high = take(count - 32);
+                return (high << 32) | take(32);
+            }
+            else
+            {
+                const uint64_t low = take(32);
+                return low | (take(count - 32) << 32);
+            }
+        }
+        return take(count);
+    }
+
+    /// Reads a number of bits holding a two's complement value.
+    ///
+    /// @param count the number of bits to read, between 1 and 64
+    /// @return the read bits sign extended to 64 bits
+    int64_t read_signed_bits(uint32_t count) noexcept(CheckPolicy::is_noexcept)
+    {
+        assert(count > 0 && "A signed value needs at least one bit");
+
+        const uint64_t value = read_bits(count);
+        const uint64_t sign = 1ULL << (count - 1);
+        return static_cast<int64_t>((value ^ sign) - sign);
+    }
+
+    /// Reads a single bit.
+    ///
+    /// @return true if the bit is set
+    bool read_bit() noexcept(CheckPolicy::is_noexcept)
+    {
+        return read_bits(1) != 0;
+    }
+
+    /// Skips over a number of bits.
+    ///
+    /// @param count the number of bits to skip
+    void skip_bits(std::size_t count) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(count <= remaining_bits(),
+                         "Skipping past the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        if (count <= m_count)
+        {
+            take(static_cast<uint32_t>(count));
+            return;
+        }
+
+        // Drop the register and continue from the byte holding the bit
+        const std::size_t position = bit_position() + count;
+        m_position = position / 8;
+        m_bits = 0;
+        m_count = 0;
+        take(position % 8);
+    }
+
+    /// Skips to the next byte boundary, unless already there.
+    void align() noexcept
+    {
+        take(m_count % 8);
+    }
+
+    /// @return true if the read position is at a byte boundary
+    bool is_aligned() const noexcept
+    {
+        return m_count % 8 == 0;
+    }
+
+    /// @return the current read position in bits
+    std::size_t bit_position() const noexcept
+    {
+        return m_position * 8 - m_count;
+    }
+
+    /// @return the remaining number of bits in the stream
+    std::size_t remaining_bits() const noexcept
+    {
+        return m_size * 8 - bit_position();
+    }
+
+    /// @return the size of the underlying buffer in bytes
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+private:
+    /// Reads a number of bits without any checks.
+    ///
+    /// @param count the number of bits, at most 56
+    uint64_t take(uint32_t count) noexcept
+    {
+        if (count > m_count)
+        {
+            refill();
+        }
+        const uint64_t value = order::first(m_bits, count);
+        m_bits = order::remove(m_bits, count);
+        m_count -= count;
+        return value;
+    }
+
+    /// Fills the register with at least 57 bits, or the rest of the buffer.
+    void refill() noexcept
+    {
+        if (m_size - m_position >= 8)
+        {
+            // The bits of the word beyond the counted bytes are the next
+            // bits of the stream, so they do no harm in the register
+            m_bits = order::append(m_bits, m_count,
+                                   order::load(m_data + m_position));
+            const uint32_t bytes = (63 - m_count) / 8;
+            m_position += bytes;
+            m_count += bytes * 8;
+            return;
+        }
+
+        while (m_count <= 56 && m_position < m_size)
+        {
+            m_bits = order::append(m_bits, m_count,
+                                   order::byte(m_data[m_position]));
+            ++m_position;
+            m_count += 8;
+        }
+    }
+
+private:
+    /// Data pointer to buffer
+    const uint8_t* m_data;
+
+    /// The size of the buffer in bytes
+    std::size_t m_size;
+
+    /// The position of the next byte to load into the register
+    std::size_t m_position = 0;
+
+    /// The register holding the next bits of the stream
+    uint64_t m_bits = 0;
+
+    /// The number of valid bits in the register
+    uint32_t m_count = 0;
+};
+}
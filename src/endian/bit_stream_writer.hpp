@@ -0,0 +1,198 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#include "assert_check.hpp"
+#include "detail/bit_order.hpp"
+
+namespace endian
+{
+/// The bit_stream_writer writes values of any number of bits, up to 64, to a
+/// fixed size buffer, using the same bit order as the bit_stream_reader with
+/// the same EndianType.
+///
+/// The bits are collected in a 64 bit register and only written to the
+/// buffer once it is full, so most writes are a shift and an or. Call
+/// flush() when done to write the remaining bits, padding the last byte with
+/// zero bits.
+///
+/// Every write is bounds checked once according to the CheckPolicy. A write
+/// rejected by the policy leaves the stream unchanged.
+template <typename EndianType, typename CheckPolicy = assert_check>
+class bit_stream_writer : public CheckPolicy
+{
+    using order = detail::bit_order<EndianType>;
+
+public:
+    /// Creates a bit stream on top of a buffer of the specified size.
+    ///
+    /// @param data a data pointer to the buffer
+    /// @param size the size of the buffer in bytes
+    bit_stream_writer(uint8_t* data, std::size_t size) noexcept :
+        m_data(data), m_size(size)
+    {
+        assert((data != nullptr || size == 0) && "Nullpointer provided");
+    }
+
+    /// Writes the lowest bits of a value.
+    ///
+    /// @param value the value to write, bits above count are ignored
+    /// @param count the number of bits to write, at most 64
+    void write_bits(uint64_t value,
+                    uint32_t count) noexcept(CheckPolicy::is_noexcept)
+    {
+        assert(count <= 64 && "At most 64 bits can be written at once");
+
+        if (!this->check(count <= remaining_bits(),
+                         "Writing over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        if (count == 0)
+        {
+            return;
+        }
+        if (count > 56)
+        {
+            const uint64_t high = (value >> 32) & ((1ULL << (count - 32)) - 1);
+            if (order::is_msb_first)
+            {
+                put(high, count - 32);
+                put(value & 0xFFFFFFFFULL, 32);
+            }
+            else
+            {
+                put(value & 0xFFFFFFFFULL, 32);
+                put(high, count - 32);
+            }
+            return;
+        }
+        put(value & ((1ULL << count) - 1), count);
+    }
+
+    /// Writes a two's complement value in a number of bits.
+    ///
+    /// @param value the value to write, which must fit in count bits
+    /// @param count the number of bits to write, between 1 and 64
+    void write_signed_bits(int64_t value,
+                           uint32_t count) noexcept(CheckPolicy::is_noexcept)
+    {
+        assert(count > 0 && "A signed value needs at least one bit");
+        assert((count == 64 ||
+                (value >= -(1LL << (count - 1)) &&
+                 value < (1LL << (count - 1)))) &&
+               "The value does not fit in the number of bits");
+
+        write_bits(static_cast<uint64_t>(value), count);
+    }
+
+    /// Writes a single bit.
+    ///
+    /// @param bit true to write a set bit
+    void write_bit(bool bit) noexcept(CheckPolicy::is_noexcept)
+    {
+        write_bits(bit ? 1 : 0, 1);
+    }
+
+    /// Pads with zero bits to the next byte boundary, unless already there.
+    void align() noexcept
+    {
+        const uint32_t padding = (8 - m_count % 8) % 8;
+        if (padding != 0)
+        {
+            put(0, padding);
+        }
+    }
+
+    /// @return true if the write position is at a byte boundary
+    bool is_aligned() const noexcept
+    {
+        return m_count % 8 == 0;
+    }
+
+    /// Pads with zero bits to the next byte boundary and writes all bits to
+    /// the buffer. Writing can continue after a flush.
+    void flush() noexcept
+    {
+        align();
+        store();
+    }
+
+    /// @return the current write position in bits
+    std::size_t bit_position() const noexcept
+    {
+        return m_position * 8 + m_count;
+    }
+
+    /// @return the remaining number of bits in the stream
+    std::size_t remaining_bits() const noexcept
+    {
+        return m_size * 8 - bit_position();
+    }
+
+    /// @return the number of bytes written to the buffer, which is the
+    ///         size of the data after a flush()
+    std::size_t position() const noexcept
+    {
+        return m_position;
+    }
+
+    /// @return the size of the underlying buffer in bytes
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+private:
+    /// Adds bits to the register without any checks, storing the full bytes
+    /// of the register first if there is no room.
+    ///
+    /// @param value the bits to add, with no bits set above count
+    /// @param count the number of bits, between 1 and 56
+    void put(uint64_t value, uint32_t count) noexcept
+    {
+        if (count > 64 - m_count)
+        {
+            store();
+        }
+        m_bits |= order::place(value, m_count, count);
+        m_count += count;
+    }
+
+    /// Writes the full bytes of the register to the buffer.
+    void store() noexcept
+    {
+        while (m_count >= 8)
+        {
+            m_data[m_position] =
+                static_cast<uint8_t>(order::first(m_bits, 8));
+            m_bits = order::remove(m_bits, 8);
+            ++m_position;
+            m_count -= 8;
+        }
+    }
+
+private:
+    /// Data pointer to buffer
+    uint8_t* m_data;
+
+    /// The size of the buffer in bytes
+    std::size_t m_size;
+
+    /// The number of bytes written to the buffer
+    std::size_t m_position = 0;
+
+    /// The register holding the bits not yet written
+    uint64_t m_bits = 0;
+
+    /// The number of bits in the register
+    uint32_t m_count = 0;
+};
+}
@@ -0,0 +1,532 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <system_error>
+#include <thread>
+
+#include "assert_check.hpp"
+#include "detail/variadic.hpp"
+#include "detail/varint.hpp"
+#include "serialized_size.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <poll.h>
+#include <unistd.h>
+
+namespace endian
+{
+/// The buffered_stream_reader reads from a file descriptor, e.g. a pipe, a
+/// socket or a file too large to map, through a pair of buffers. A background
+/// thread reads ahead into one buffer while values are decoded from the
+/// other, so decoding overlaps with the I/O instead of waiting for a read(2)
+/// whenever a buffer runs empty.
+///
+/// Values straddling the boundary between two buffers are read like any
+/// other value. The end of the stream is reached when read(2) returns zero or
+/// fails. Reading past it is handled by the CheckPolicy like reading past the
+/// end of the buffer of a stream_reader, and a failed read(2) is available
+/// from read_error().
+///
+/// The file descriptor is not closed by the reader.
+template <typename EndianType, typename CheckPolicy = assert_check>
+class buffered_stream_reader : public CheckPolicy
+{
+public:
+    /// The largest number of bytes which can be read or peeked at once by a
+    /// single value, including the peek offset
+    static constexpr std::size_t max_lookahead = 64;
+
+    /// Creates a reader and starts reading ahead.
+    ///
+    /// @param fd the file descriptor to read from
+    /// @param buffer_size the size of each of the two buffers in bytes
+    explicit buffered_stream_reader(int fd,
+                                    std::size_t buffer_size = 64 * 1024) :
+        m_fd(fd),
+        m_buffer_size(std::max(buffer_size, max_lookahead))
+    {
+        assert(fd >= 0 && "Invalid file descriptor");
+
+        // The pipe wakes the read-ahead thread up from poll when the reader
+        // is destroyed while the file descriptor has no data
+        if (pipe(m_wake) != 0)
+        {
+            throw std::system_error(errno, std::generic_category(),
+                                    "Could not create the wake-up pipe");
+        }
+        for (auto& block : m_blocks)
+        {
+            block.storage.reset(new uint8_t[max_lookahead + m_buffer_size]);
+        }
+        m_thread = std::thread([this]() { read_ahead(); });
+    }
+
+    buffered_stream_reader(const buffered_stream_reader&) = delete;
+    buffered_stream_reader& operator=(const buffered_stream_reader&) = delete;
+
+    /// Stops the read-ahead thread
+    ~buffered_stream_reader()
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_ready.notify_all();
+        const uint8_t wake = 0;
+        (void)!write(m_wake[1], &wake, 1);
+        m_thread.join();
+        close(m_wake[0]);
+        close(m_wake[1]);
+    }
+
+    /// Reads a Bytes-sized integer from the stream.
+    ///
+    /// @param value reference to the value to be read
+    template <uint8_t Bytes, class ValueType>
+    void read_bytes(ValueType& value) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(fill(Bytes), "Reading over the end of the stream"))
+        {
+            return;
+        }
+
+        EndianType::template get_bytes<Bytes>(value, m_read);
+        advance(Bytes);
+    }
+
+    /// Reads a ValueType-sized integer from the stream.
+    ///
+    /// @param value reference to the value to be read
+    template <class ValueType>
+    void read(ValueType& value) noexcept(CheckPolicy::is_noexcept)
+    {
+        read_bytes<sizeof(ValueType), ValueType>(value);
+    }
+
+    /// Reads a ValueType-sized integer from the stream.
+    ///
+    /// @return the read value
+    template <class ValueType>
+    ValueType read() noexcept(CheckPolicy::is_noexcept)
+    {
+        ValueType value = 0;
+        read(value);
+        return value;
+    }
+
+    /// Reads a number of values from the stream in the order given, checking
+    /// the available data once for all of them.
+    ///
+    /// @param values references to the values to be read
+    template <class... ValueTypes>
+    void read_all(ValueTypes&... values) noexcept(CheckPolicy::is_noexcept)
+    {
+        const std::size_t size = serialized_size<ValueTypes...>::value;
+        static_assert(serialized_size<ValueTypes...>::value <= max_lookahead,
+                      "The values are larger than the lookahead");
+
+        if (!this->check(fill(size), "Reading over the end of the stream"))
+        {
+            return;
+        }
+
+        detail::variadic<EndianType>::get(m_read, values...);
+        advance(size);
+    }
+
+    /// Reads raw bytes from the stream without any endian conversion.
+    ///
+    /// Unlike the other reads, a read over the end of the stream stores the
+    /// bytes which were available before it is reported.
+    ///
+    /// @param data the data pointer to fill into
+    /// @param size the number of bytes to fill
+    void read(uint8_t* data, std::size_t size) noexcept(
+        CheckPolicy::is_noexcept)
+    {
+        while (size != 0)
+        {
+            if (!this->check(fill(1), "Reading over the end of the stream"))
+            {
+                return;
+            }
+            const std::size_t chunk = std::min(size, buffered_size());
+            std::copy_n(m_read, chunk, data);
+            advance(chunk);
+            data += chunk;
+            size -= chunk;
+        }
+    }
+
+    /// Reads an array of ValueType-sized values from the stream, converting
+    /// the values in each buffer in bulk.
+    ///
+    /// @param values pointer to where the values should be stored
+    /// @param elements the number of values to read
+    template <class ValueType>
+    void read_array(ValueType* values,
+                    std::size_t elements) noexcept(CheckPolicy::is_noexcept)
+    {
+        while (elements != 0)
+        {
+            if (!this->check(fill(sizeof(ValueType)),
+                             "Reading over the end of the stream"))
+            {
+                return;
+            }
+            const std::size_t chunk =
+                std::min(elements, buffered_size() / sizeof(ValueType));
+            EndianType::get_array(values, chunk, m_read);
+            advance(chunk * sizeof(ValueType));
+            values += chunk;
+            elements -= chunk;
+        }
+    }
+
+    /// Reads a variable-length integer (LEB128) from the stream, see
+    /// stream_reader::read_varint.
+    ///
+    /// @param value reference to the value to be read
+    template <class ValueType>
+    void read_varint(ValueType& value) noexcept(CheckPolicy::is_noexcept)
+    {
+        using varint_value = detail::varint_value<ValueType>;
+
+        // The last varint of the stream may be shorter than the largest
+        fill(detail::max_varint_size);
+
+        uint64_t encoded = 0;
+        std::size_t length = 0;
+        const detail::varint_error error =
+            detail::decode_varint(m_read, buffered_size(), encoded, length);
+
+        if (!this->check(error != detail::varint_error::truncated,
+                         "Reading over the end of the stream"))
+        {
+            return;
+        }
+        if (!this->check_format(error == detail::varint_error::none &&
+                                    varint_value::fits(encoded),
+                                "Overlong varint"))
+        {
+            return;
+        }
+
+        value = varint_value::decode(encoded);
+        advance(length);
+    }
+
+    /// Reads a variable-length integer (LEB128) from the stream.
+    ///
+    /// @return the read value
+    template <class ValueType>
+    ValueType read_varint() noexcept(CheckPolicy::is_noexcept)
+    {
+        ValueType value = 0;
+        read_varint(value);
+        return value;
+    }
+
+    /// Peeks a Bytes-sized integer in the stream without moving the read
+    /// position. This waits for the data to arrive if it is not buffered.
+    ///
+    /// @param value reference to the value to be read
+    /// @param offset number of bytes to offset the peeking with, at most
+    ///        max_lookahead - Bytes
+    template <uint8_t Bytes, class ValueType>
+    void peek_bytes(ValueType& value, std::size_t offset = 0) noexcept(
+        CheckPolicy::is_noexcept)
+    {
+        // The offset may come from the data, so it is checked like the end
+        // of the stream
+        if (!this->check(offset <= max_lookahead - Bytes,
+                         "Peeking further than the lookahead"))
+        {
+            return;
+        }
+
+        if (!this->check(fill(offset + Bytes),
+                         "Reading over the end of the stream"))
+        {
+            return;
+        }
+
+        EndianType::template get_bytes<Bytes>(value, m_read + offset);
+    }
+
+    /// Peeks a ValueType-sized integer in the stream without moving the read
+    /// position.
+    ///
+    /// @param value reference to the value to be read
+    /// @param offset number of bytes to offset the peeking with
+    template <class ValueType>
+    void peek(ValueType& value, std::size_t offset = 0) noexcept(
+        CheckPolicy::is_noexcept)
+    {
+        peek_bytes<sizeof(ValueType), ValueType>(value, offset);
+    }
+
+    /// Peeks a ValueType-sized integer in the stream without moving the read
+    /// position.
+    ///
+    /// @param offset number of bytes to offset the peeking with
+    /// @return the peeked value
+    template <class ValueType>
+    ValueType peek(std::size_t offset = 0) noexcept(CheckPolicy::is_noexcept)
+    {
+        ValueType value = 0;
+        peek(value, offset);
+        return value;
+    }
+
+    /// Skips over a number of bytes in the stream.
+    ///
+    /// @param size the number of bytes to skip
+    void skip(std::size_t size) noexcept(CheckPolicy::is_noexcept)
+    {
+        while (size != 0)
+        {
+            if (!this->check(fill(1), "Skipping over the end of the stream"))
+            {
+                return;
+            }
+            const std::size_t chunk = std::min(size, buffered_size());
+            advance(chunk);
+            size -= chunk;
+        }
+    }
+
+    /// Operator for reading the next value from the stream.
+    ///
+    /// @return the reader
+    template <typename ValueType>
+    buffered_stream_reader& operator>>(ValueType& value)
+    {
+        read(value);
+        return *this;
+    }
+
+    /// @return the number of bytes read from the stream so far
+    uint64_t position() const noexcept
+    {
+        return m_position;
+    }
+
+    /// @return the number of bytes which can be read without waiting for the
+    ///         read-ahead thread
+    std::size_t buffered_size() const noexcept
+    {
+        return static_cast<std::size_t>(m_end - m_read);
+    }
+
+    /// Checks if every byte of the stream has been read. This waits for the
+    /// read-ahead thread if no data is buffered.
+    ///
+    /// @return true if the end of the stream has been reached
+    bool at_end()
+    {
+        return !fill(1);
+    }
+
+    /// @return the error of a failed read(2), or an empty error code if the
+    ///         stream ended normally or has not ended
+    std::error_code read_error() const noexcept
+    {
+        return m_read_error;
+    }
+
+private:
+    // A buffer with room for the unread bytes of the previous buffer in
+    // front of the data
+    struct block
+    {
+        std::unique_ptr<uint8_t[]> storage;
+        std::size_t size = 0;
+        bool full = false;
+        bool end = false;
+        std::error_code error;
+    };
+
+    void advance(std::size_t size) noexcept
+    {
+        assert(size <= buffered_size());
+        m_read += size;
+        m_position += size;
+    }
+
+    // Makes sure that at least size bytes are buffered contiguously, moving
+    // on to the next buffer as needed. Returns false if the stream ends
+    // first.
+    bool fill(std::size_t size)
+    {
+        assert(size <= max_lookahead && "Reading more than the lookahead");
+        while (buffered_size() < size)
+        {
+            if (m_end_reached)
+            {
+                return false;
+            }
+            next_block();
+        }
+        return true;
+    }
+
+    // Waits for the next buffer and copies the unread bytes of the current
+    // buffer in front of its data before handing the current buffer back to
+    // the read-ahead thread
+    void next_block()
+    {
+        const std::size_t next = m_current ^ 1;
+        block& incoming = m_blocks[next];
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_ready.wait(lock, [&]() { return incoming.full; });
+
+        const std::size_t tail = buffered_size();
+        uint8_t* data = incoming.storage.get() + max_lookahead;
+        std::copy_n(m_read, tail, data - tail);
+        m_read = data - tail;
+        m_end = data + incoming.size;
+
+        if (incoming.end)
+        {
+            m_end_reached = true;
+            m_read_error = incoming.error;
+        }
+        if (m_started)
+        {
+            m_blocks[m_current].full = false;
+            lock.unlock();
+            m_ready.notify_all();
+        }
+        m_started = true;
+        m_current = next;
+    }
+
+    // The read-ahead thread, filling the buffers in turn until the stream
+    // ends or the reader is destroyed
+    void read_ahead()
+    {
+        std::size_t index = 0;
+        while (true)
+        {
+            block& outgoing = m_blocks[index];
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_ready.wait(lock, [&]() { return m_stop || !outgoing.full; });
+                if (m_stop)
+                {
+                    return;
+                }
+            }
+
+            std::error_code error;
+            const std::size_t size =
+                read_some(outgoing.storage.get() + max_lookahead, error);
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                if (m_stop)
+                {
+                    return;
+                }
+                outgoing.size = size;
+                outgoing.end = size == 0;
+                outgoing.error = error;
+                outgoing.full = true;
+            }
+            m_ready.notify_all();
+
+            if (size == 0)
+            {
+                return;
+            }
+            index ^= 1;
+        }
+    }
+
+    // Reads what is available into a buffer, waiting for data if there is
+    // none. Returns zero at the end of the stream, on an error or when the
+    // reader is being destroyed.
+    std::size_t read_some(uint8_t* data, std::error_code& error)
+    {
+        while (true)
+        {
+            pollfd fds[2] = {{m_fd, POLLIN, 0}, {m_wake[0], POLLIN, 0}};
+            if (poll(fds, 2, -1) < 0)
+            {
+                if (errno == EINTR)
+                {
+                    continue;
+                }
+                error = std::error_code(errno, std::generic_category());
+                return 0;
+            }
+            if (fds[1].revents != 0)
+            {
+                return 0;
+            }
+
+            const ssize_t result = ::read(m_fd, data, m_buffer_size);
+            if (result >= 0)
+            {
+                return static_cast<std::size_t>(result);
+            }
+            if (errno != EINTR && errno != EAGAIN && errno != EWOULDBLOCK)
+            {
+                error = std::error_code(errno, std::generic_category());
+                return 0;
+            }
+        }
+    }
+
+private:
+    /// The file descriptor read from
+    int m_fd;
+
+    /// The size of the data part of each buffer
+    std::size_t m_buffer_size;
+
+    /// The two buffers, one being read while the other is filled
+    block m_blocks[2];
+
+    /// The buffer being read and the unread part of it
+    std::size_t m_current = 1;
+    const uint8_t* m_read = nullptr;
+    const uint8_t* m_end = nullptr;
+    bool m_started = false;
+
+    /// The number of bytes read so far
+    uint64_t m_position = 0;
+
+    /// Set when the last buffer of the stream has been reached
+    bool m_end_reached = false;
+    std::error_code m_read_error;
+
+    /// Synchronizes the hand over of the buffers
+    std::mutex m_mutex;
+    std::condition_variable m_ready;
+    bool m_stop = false;
+
+    /// Pipe for waking up the read-ahead thread
+    int m_wake[2] = {-1, -1};
+
+    std::thread m_thread;
+};
+
+template <typename EndianType, typename CheckPolicy>
+constexpr std::size_t
+    buffered_stream_reader<EndianType, CheckPolicy>::max_lookahead;
+}
+#endif
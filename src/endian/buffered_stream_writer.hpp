@@ -0,0 +1,469 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <system_error>
+#include <vector>
+
+#include "detail/variadic.hpp"
+#include "detail/varint.hpp"
+#include "detail/write_queue.hpp"
+#include "serialized_size.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/types.h>
+#include <unistd.h>
+
+namespace endian
+{
+/// How the blocks of a buffered_stream_writer are handed to the kernel
+enum class write_backend
+{
+    /// io_uring where it is available, otherwise a writer thread
+    automatic,
+
+    /// Submit the writes through an io_uring without a thread. Falls back to
+    /// the writer thread if io_uring is not available or the file descriptor
+    /// is not seekable.
+    io_uring,
+
+    /// Write with pwrite(2), or write(2) if the file descriptor is not
+    /// seekable, on a background thread
+    thread
+};
+
+/// Options for a buffered_stream_writer
+struct write_options
+{
+    /// The size of each block in bytes. Rounded up to the alignment.
+    std::size_t block_size = 1024 * 1024;
+
+    /// The number of blocks, i.e. one being filled and the rest in flight
+    std::size_t blocks = 4;
+
+    /// The alignment of the blocks in memory and in the file, or zero if
+    /// there is no requirement. Set it to the logical block size of the
+    /// device, e.g. 4096, when the file descriptor is opened with O_DIRECT.
+    std::size_t alignment = 0;
+
+    /// How the blocks are written
+    write_backend backend = write_backend::automatic;
+};
+
+/// The buffered_stream_writer writes to a file descriptor, e.g. a file, a
+/// pipe or a socket, through a number of fixed size blocks. A full block is
+/// handed to the kernel without waiting for the write, and the writer moves
+/// on to the next free block. Encoding therefore only waits for the I/O when
+/// every block is in flight.
+///
+/// The blocks are written with io_uring on Linux, which keeps several writes
+/// in flight without a thread, and otherwise on a background thread. Writes
+/// to a seekable file descriptor start at its current offset, and the offset
+/// is moved past the written data by flush().
+///
+/// With an alignment the blocks are aligned in memory and written at aligned
+/// offsets, as required by O_DIRECT. A partially filled block is written
+/// padded with zeros by flush(), which truncates the file to the size of the
+/// written data again.
+///
+/// Errors of the writes are not reported while writing values, but are
+/// available from write_error() once a block has been written, e.g. after
+/// flush(). The data written after an error is discarded. The file descriptor
+/// is not closed by the writer.
+template <typename EndianType>
+class buffered_stream_writer
+{
+public:
+    /// Creates a writer.
+    ///
+    /// @param fd the file descriptor to write to
+    /// @param options the block sizes and the backend
+    explicit buffered_stream_writer(int fd,
+                                    const write_options& options =
+                                        write_options()) :
+        m_fd(fd),
+        m_alignment(std::max<std::size_t>(options.alignment, 1))
+    {
+        assert(fd >= 0 && "Invalid file descriptor");
+
+        const off_t offset = lseek(fd, 0, SEEK_CUR);
+        m_seekable = offset >= 0;
+        m_offset = m_seekable ? static_cast<uint64_t>(offset) : 0;
+        assert((m_offset % m_alignment == 0 || !m_seekable) &&
+               "The file offset is not aligned");
+
+        m_block_size = std::max<std::size_t>(options.block_size, 1);
+        m_block_size = (m_block_size + m_alignment - 1) / m_alignment *
+                       m_alignment;
+
+        m_blocks.resize(std::max<std::size_t>(options.blocks, 2));
+        for (auto& block : m_blocks)
+        {
+            void* storage = nullptr;
+            if (posix_memalign(&storage, std::max<std::size_t>(m_alignment, 64),
+                               m_block_size) != 0)
+            {
+                throw std::bad_alloc();
+            }
+            block.storage.reset(static_cast<uint8_t*>(storage));
+            block.write.data = block.storage.get();
+            m_free.push_back(&block.write);
+        }
+
+        start(options.backend);
+        next_block();
+    }
+
+    buffered_stream_writer(const buffered_stream_writer&) = delete;
+    buffered_stream_writer& operator=(const buffered_stream_writer&) = delete;
+
+    /// Writes the buffered data and waits for the writes to complete
+    ~buffered_stream_writer()
+    {
+        flush();
+        m_queue.reset();
+    }
+
+    /// Writes a Bytes-sized integer to the stream.
+    ///
+    /// @param value the value to write.
+    template <uint8_t Bytes, class ValueType>
+    void write_bytes(ValueType value)
+    {
+        if (remaining_size() >= Bytes)
+        {
+            EndianType::template put_bytes<Bytes>(value, m_write);
+            m_write += Bytes;
+            return;
+        }
+
+        // The value straddles two blocks
+        uint8_t encoded[Bytes];
+        EndianType::template put_bytes<Bytes>(value, encoded);
+        write(encoded, Bytes);
+    }
+
+    /// Writes a ValueType-sized integer to the stream.
+    ///
+    /// @param value the value to write.
+    template <class ValueType>
+    void write(ValueType value)
+    {
+        write_bytes<sizeof(ValueType), const ValueType>(value);
+    }
+
+    /// Writes a number of values to the stream in the order given.
+    ///
+    /// @param values the values to write
+    template <class... ValueTypes>
+    void write_all(const ValueTypes&... values)
+    {
+        const std::size_t size = serialized_size<ValueTypes...>::value;
+        if (remaining_size() >= size)
+        {
+            detail::variadic<EndianType>::put(m_write, values...);
+            m_write += size;
+            return;
+        }
+
+        uint8_t encoded[size];
+        detail::variadic<EndianType>::put(encoded, values...);
+        write(encoded, size);
+    }
+
+    /// Writes raw bytes to the stream without any endian conversion.
+    ///
+    /// @param data Pointer to the data, to be written to the stream.
+    /// @param size Number of bytes from the data pointer.
+    void write(const uint8_t* data, std::size_t size)
+    {
+        while (size != 0)
+        {
+            if (remaining_size() == 0)
+            {
+                submit_block();
+            }
+            const std::size_t chunk = std::min(size, remaining_size());
+            std::copy_n(data, chunk, m_write);
+            m_write += chunk;
+            data += chunk;
+            size -= chunk;
+        }
+    }
+
+    /// Writes an array of ValueType-sized values to the stream, converting
+    /// the values in each block in bulk.
+    ///
+    /// @param values pointer to the values to write
+    /// @param elements the number of values to write
+    template <class ValueType>
+    void write_array(const ValueType* values, std::size_t elements)
+    {
+        while (elements != 0)
+        {
+            const std::size_t chunk =
+                std::min(elements, remaining_size() / sizeof(ValueType));
+            if (chunk == 0)
+            {
+                write(*values);
+                ++values;
+                --elements;
+                continue;
+            }
+            EndianType::put_array(values, chunk, m_write);
+            m_write += chunk * sizeof(ValueType);
+            values += chunk;
+            elements -= chunk;
+        }
+    }
+
+    /// Writes a variable-length integer (LEB128) to the stream, see
+    /// stream_writer::write_varint().
+    ///
+    /// @param value the value to write.
+    template <class ValueType>
+    void write_varint(ValueType value)
+    {
+        const uint64_t encoded = detail::varint_value<ValueType>::encode(value);
+        const std::size_t size = detail::varint_size(encoded);
+        if (remaining_size() >= size)
+        {
+            detail::encode_varint(encoded, m_write);
+            m_write += size;
+            return;
+        }
+
+        uint8_t bytes[10];
+        detail::encode_varint(encoded, bytes);
+        write(bytes, size);
+    }
+
+    /// Operator for writing given value to the end of the stream.
+    ///
+    /// @param value the value to write.
+    template <typename ValueType>
+    buffered_stream_writer& operator<<(ValueType value)
+    {
+        write(value);
+        return *this;
+    }
+
+    /// Writes the buffered data and waits for every write to complete. The
+    /// offset of a seekable file descriptor is moved past the written data.
+    ///
+    /// @return the error of the first failed write, if any
+    std::error_code flush()
+    {
+        // A partial block is padded to the alignment and truncated again
+        const bool padded = m_alignment > 1 && m_seekable &&
+                            buffered_size() != 0 &&
+                            remaining_size() != 0;
+        if (padded)
+        {
+            flush_aligned(buffered_size());
+        }
+        else if (buffered_size() != 0)
+        {
+            submit_block();
+        }
+
+        while (detail::write_block* block = m_queue->wait_completion())
+        {
+            complete(block);
+        }
+
+        if (m_seekable && !m_error)
+        {
+            const uint64_t end = m_offset + buffered_size();
+            if (padded && ftruncate(m_fd, static_cast<off_t>(end)) != 0)
+            {
+                m_error = std::error_code(errno, std::generic_category());
+            }
+            lseek(m_fd, static_cast<off_t>(end), SEEK_SET);
+        }
+        return m_error;
+    }
+
+    /// @return the number of bytes written to the stream so far
+    uint64_t position() const noexcept
+    {
+        return m_written + buffered_size();
+    }
+
+    /// @return the number of bytes in the current block which have not been
+    ///         handed to the kernel yet
+    std::size_t buffered_size() const noexcept
+    {
+        return static_cast<std::size_t>(m_write - m_block->data);
+    }
+
+    /// @return the number of bytes which can be written before the current
+    ///         block is handed to the kernel
+    std::size_t remaining_size() const noexcept
+    {
+        return static_cast<std::size_t>(m_end - m_write);
+    }
+
+    /// @return the backend used to write the blocks
+    write_backend backend() const noexcept
+    {
+        return m_backend;
+    }
+
+    /// @return the error of the first failed write, or an empty error code
+    ///         if every completed write succeeded
+    std::error_code write_error() const noexcept
+    {
+        return m_error;
+    }
+
+private:
+    struct free_deleter
+    {
+        void operator()(uint8_t* data) const noexcept
+        {
+            std::free(data);
+        }
+    };
+
+    struct block
+    {
+        std::unique_ptr<uint8_t, free_deleter> storage;
+        detail::write_block write;
+    };
+
+    void start(write_backend backend)
+    {
+#if defined(ENDIAN_IO_URING)
+        if (backend != write_backend::thread && m_seekable)
+        {
+            std::error_code error;
+            std::unique_ptr<detail::uring_write_queue> queue(
+                new detail::uring_write_queue(
+                    m_fd, static_cast<unsigned>(m_blocks.size()), error));
+            if (!error)
+            {
+                m_queue = std::move(queue);
+                m_backend = write_backend::io_uring;
+                return;
+            }
+        }
+#else
+        (void)backend;
+#endif
+        m_queue.reset(new detail::thread_write_queue(m_fd, m_seekable));
+        m_backend = write_backend::thread;
+    }
+
+    // Hands the current block to the kernel and moves on to a free block
+    void submit_block()
+    {
+        const std::size_t size = buffered_size();
+        m_block->size = size;
+        m_block->written = 0;
+        m_block->offset = m_offset;
+        m_offset += size;
+        m_written += size;
+        submit(m_block);
+        next_block();
+    }
+
+    // Writes the partially filled current block padded to the alignment,
+    // keeping it as the current block. The block is written again at the
+    // same offset once it is full or flushed again.
+    void flush_aligned(std::size_t size)
+    {
+        const std::size_t padded =
+            (size + m_alignment - 1) / m_alignment * m_alignment;
+        std::fill(m_write, m_block->data + padded, uint8_t{0});
+        m_block->size = padded;
+        m_block->written = 0;
+        m_block->offset = m_offset;
+        m_flushing = m_block;
+        submit(m_block);
+    }
+
+    void submit(detail::write_block* block)
+    {
+        // Data written after an error would leave a hole in the file
+        if (m_error)
+        {
+            complete(block);
+            return;
+        }
+        m_queue->submit(block);
+    }
+
+    void next_block()
+    {
+        while (detail::write_block* block = m_queue->poll_completion())
+        {
+            complete(block);
+        }
+        while (m_free.empty())
+        {
+            complete(m_queue->wait_completion());
+        }
+        m_block = m_free.back();
+        m_free.pop_back();
+        m_write = m_block->data;
+        m_end = m_block->data + m_block_size;
+    }
+
+    void complete(detail::write_block* block)
+    {
+        assert(block != nullptr);
+        if (block->error && !m_error)
+        {
+            m_error = block->error;
+        }
+        block->error.clear();
+
+        // The padded current block stays in use after a flush
+        if (block == m_flushing)
+        {
+            m_flushing = nullptr;
+            return;
+        }
+        m_free.push_back(block);
+    }
+
+private:
+    int m_fd;
+    bool m_seekable = false;
+    std::size_t m_alignment;
+    std::size_t m_block_size = 0;
+
+    std::vector<block> m_blocks;
+    std::vector<detail::write_block*> m_free;
+    std::unique_ptr<detail::write_queue> m_queue;
+    write_backend m_backend = write_backend::thread;
+
+    /// The block being filled
+    detail::write_block* m_block = nullptr;
+    uint8_t* m_write = nullptr;
+    uint8_t* m_end = nullptr;
+
+    /// The current block while it is written by flush()
+    detail::write_block* m_flushing = nullptr;
+
+    /// The file offset of the current block
+    uint64_t m_offset = 0;
+
+    /// The number of bytes handed to the kernel
+    uint64_t m_written = 0;
+
+    std::error_code m_error;
+};
+}
+#endif
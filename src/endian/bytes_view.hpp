@@ -0,0 +1,278 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+#include "detail/view_iterator.hpp"
+
+namespace endian
+{
+namespace detail
+{
+// Copies values between a view and a host array, using the bulk array
+// conversion when the values are full width
+template <class EndianType, uint8_t Bytes, class ValueType,
+          bool IsFullWidth = (Bytes == sizeof(ValueType))>
+struct view_copy
+{
+    static void get(ValueType* values, std::size_t size, const uint8_t* data)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            values[i] =
+                EndianType::template get_bytes<Bytes, ValueType>(data + i * Bytes);
+        }
+    }
+
+    static void put(const ValueType* values, std::size_t size, uint8_t* data)
+    {
+        for (std::size_t i = 0; i < size; ++i)
+        {
+            EndianType::template put_bytes<Bytes>(values[i], data + i * Bytes);
+        }
+    }
+};
+
+template <class EndianType, uint8_t Bytes, class ValueType>
+struct view_copy<EndianType, Bytes, ValueType, true>
+{
+    static void get(ValueType* values, std::size_t size, const uint8_t* data)
+    {
+        EndianType::get_array(values, size, data);
+    }
+
+    static void put(const ValueType* values, std::size_t size, uint8_t* data)
+    {
+        EndianType::put_array(values, size, data);
+    }
+};
+}
+
+/// A read-only view of an array of Bytes-sized values stored back to back in
+/// the byte order of EndianType, e.g. in a received message. The values are
+/// converted when accessed, so the view can be passed directly to standard
+/// algorithms such as std::lower_bound or std::accumulate without copying
+/// the array first.
+template <class EndianType, uint8_t Bytes, class ValueType>
+class bytes_view
+{
+    static_assert(Bytes > 0 && Bytes <= sizeof(ValueType),
+                  "The values must fit in the ValueType");
+
+public:
+    using value_type = ValueType;
+    using size_type = std::size_t;
+    using iterator =
+        detail::view_iterator<EndianType, Bytes, ValueType, const uint8_t*>;
+    using const_iterator = iterator;
+    using reference = ValueType;
+
+    /// Creates a view of a number of values.
+    ///
+    /// @param data pointer to the first value
+    /// @param size the number of values
+    bytes_view(const uint8_t* data, std::size_t size) noexcept :
+        m_data(data), m_size(size)
+    {
+        assert((data != nullptr || size == 0) && "Nullpointer provided");
+    }
+
+    /// @param index the index of a value, must be less than size()
+    /// @return the value
+    ValueType operator[](std::size_t index) const noexcept
+    {
+        assert(index < m_size && "Index out of range");
+        return EndianType::template get_bytes<Bytes, ValueType>(
+            m_data + index * Bytes);
+    }
+
+    /// @return the first value
+    ValueType front() const noexcept
+    {
+        return (*this)[0];
+    }
+
+    /// @return the last value
+    ValueType back() const noexcept
+    {
+        return (*this)[m_size - 1];
+    }
+
+    /// Converts all values into a host array, using the bulk conversion of
+    /// the EndianType when the values are full width.
+    ///
+    /// @param values pointer to where the size() values are stored
+    void copy_to(ValueType* values) const noexcept
+    {
+        detail::view_copy<EndianType, Bytes, ValueType>::get(values, m_size,
+                                                             m_data);
+    }
+
+    /// @return iterator to the first value
+    iterator begin() const noexcept
+    {
+        return iterator(m_data);
+    }
+
+    /// @return iterator past the last value
+    iterator end() const noexcept
+    {
+        return iterator(m_data + m_size * Bytes);
+    }
+
+    /// @return the number of values
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @return the size of the values in bytes
+    std::size_t size_bytes() const noexcept
+    {
+        return m_size * Bytes;
+    }
+
+    /// @return true if there are no values
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /// @return pointer to the first value
+    const uint8_t* data() const noexcept
+    {
+        return m_data;
+    }
+
+private:
+    /// Pointer to the first value
+    const uint8_t* m_data;
+
+    /// The number of values
+    std::size_t m_size;
+};
+
+/// A view of an array of Bytes-sized values stored back to back in the byte
+/// order of EndianType, which also allows changing the values. Accessing a
+/// value gives a proxy reference which converts on load and store, so the
+/// view can be the output of standard algorithms such as std::transform.
+template <class EndianType, uint8_t Bytes, class ValueType>
+class mutable_bytes_view
+{
+    static_assert(Bytes > 0 && Bytes <= sizeof(ValueType),
+                  "The values must fit in the ValueType");
+
+public:
+    using value_type = ValueType;
+    using size_type = std::size_t;
+    using iterator =
+        detail::view_iterator<EndianType, Bytes, ValueType, uint8_t*>;
+    using const_iterator =
+        detail::view_iterator<EndianType, Bytes, ValueType, const uint8_t*>;
+    using reference = typename iterator::reference;
+
+    /// Creates a view of a number of values.
+    ///
+    /// @param data pointer to the first value
+    /// @param size the number of values
+    mutable_bytes_view(uint8_t* data, std::size_t size) noexcept :
+        m_data(data), m_size(size)
+    {
+        assert((data != nullptr || size == 0) && "Nullpointer provided");
+    }
+
+    /// @param index the index of a value, must be less than size()
+    /// @return a proxy reference to the value
+    reference operator[](std::size_t index) const noexcept
+    {
+        assert(index < m_size && "Index out of range");
+        return reference(m_data + index * Bytes);
+    }
+
+    /// Converts all values into a host array.
+    ///
+    /// @param values pointer to where the size() values are stored
+    void copy_to(ValueType* values) const noexcept
+    {
+        detail::view_copy<EndianType, Bytes, ValueType>::get(values, m_size,
+                                                             m_data);
+    }
+
+    /// Converts all values from a host array, using the bulk conversion of
+    /// the EndianType when the values are full width.
+    ///
+    /// @param values pointer to the size() values to store
+    void copy_from(const ValueType* values) const noexcept
+    {
+        detail::view_copy<EndianType, Bytes, ValueType>::put(values, m_size,
+                                                             m_data);
+    }
+
+    /// @return iterator to the first value
+    iterator begin() const noexcept
+    {
+        return iterator(m_data);
+    }
+
+    /// @return iterator past the last value
+    iterator end() const noexcept
+    {
+        return iterator(m_data + m_size * Bytes);
+    }
+
+    /// @return read-only iterator to the first value
+    const_iterator cbegin() const noexcept
+    {
+        return const_iterator(m_data);
+    }
+
+    /// @return read-only iterator past the last value
+    const_iterator cend() const noexcept
+    {
+        return const_iterator(m_data + m_size * Bytes);
+    }
+
+    /// @return the number of values
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @return the size of the values in bytes
+    std::size_t size_bytes() const noexcept
+    {
+        return m_size * Bytes;
+    }
+
+    /// @return true if there are no values
+    bool empty() const noexcept
+    {
+        return m_size == 0;
+    }
+
+    /// @return pointer to the first value
+    uint8_t* data() const noexcept
+    {
+        return m_data;
+    }
+
+    /// @return a read-only view of the values
+    operator bytes_view<EndianType, Bytes, ValueType>() const noexcept
+    {
+        return bytes_view<EndianType, Bytes, ValueType>(m_data, m_size);
+    }
+
+private:
+    /// Pointer to the first value
+    uint8_t* m_data;
+
+    /// The number of values
+    std::size_t m_size;
+};
+}
@@ -0,0 +1,21 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+
+namespace endian
+{
+/// A non-owning view of a contiguous range of bytes
+struct const_buffer
+{
+    /// Pointer to the first byte
+    const uint8_t* data;
+
+    /// The number of bytes
+    std::size_t size;
+};
+}
@@ -0,0 +1,147 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+
+#include "detail/cpuid.hpp"
+
+namespace endian
+{
+/// The instruction set levels of the vectorized kernels, in increasing
+/// order. Each level includes the ones below it.
+enum class cpu_level
+{
+    scalar,
+    sse2,
+    ssse3,
+    avx2,
+    avx512bw
+};
+
+/// The instruction set extensions supported by the CPU and the operating
+/// system
+using cpu_features = detail::cpuid_features;
+
+/// Detects the features of the CPU the first time it is called, using cpuid
+/// on x86-64. No features are reported on other architectures.
+/// @return the detected features
+inline const cpu_features& detected_cpu_features()
+{
+    static const cpu_features features = detail::detect_cpuid_features();
+    return features;
+}
+
+/// @return the highest level supported by the CPU
+inline cpu_level detected_cpu_level()
+{
+    const cpu_features& features = detected_cpu_features();
+    if (features.avx512bw && features.avx2 && features.ssse3)
+    {
+        return cpu_level::avx512bw;
+    }
+    if (features.avx2 && features.ssse3)
+    {
+        return cpu_level::avx2;
+    }
+    if (features.ssse3)
+    {
+        return cpu_level::ssse3;
+    }
+    if (features.sse2)
+    {
+        return cpu_level::sse2;
+    }
+    return cpu_level::scalar;
+}
+
+/// @param level the level
+/// @return the name of the level, as used by the ENDIAN_CPU_LEVEL
+///         environment variable
+inline const char* cpu_level_name(cpu_level level)
+{
+    switch (level)
+    {
+    case cpu_level::sse2:
+        return "sse2";
+    case cpu_level::ssse3:
+        return "ssse3";
+    case cpu_level::avx2:
+        return "avx2";
+    case cpu_level::avx512bw:
+        return "avx512bw";
+    default:
+        return "scalar";
+    }
+}
+
+namespace detail
+{
+// The detected level, lowered to the level named by the ENDIAN_CPU_LEVEL
+// environment variable if it is set
+inline cpu_level initial_cpu_level()
+{
+    const cpu_level detected = detected_cpu_level();
+#if defined(_MSC_VER)
+#pragma warning(suppress : 4996)
+#endif
+    const char* name = std::getenv("ENDIAN_CPU_LEVEL");
+    if (name == nullptr)
+    {
+        return detected;
+    }
+    for (int i = 0; i <= static_cast<int>(detected); ++i)
+    {
+        if (std::strcmp(name, cpu_level_name(static_cast<cpu_level>(i))) == 0)
+        {
+            return static_cast<cpu_level>(i);
+        }
+    }
+    return detected;
+}
+
+inline std::atomic<int>& cpu_level_state()
+{
+    static std::atomic<int> state(static_cast<int>(initial_cpu_level()));
+    return state;
+}
+}
+
+/// The level used by the vectorized kernels. This is the detected level,
+/// unless it has been lowered through the ENDIAN_CPU_LEVEL environment
+/// variable or set_cpu_level().
+/// @return the level used by the vectorized kernels
+inline cpu_level active_cpu_level()
+{
+    return static_cast<cpu_level>(
+        detail::cpu_level_state().load(std::memory_order_relaxed));
+}
+
+/// Makes the vectorized kernels use the given level, e.g. to test or
+/// benchmark the slower kernels on a fast CPU. Levels above the detected
+/// level are lowered to the detected level.
+/// @param level the level to use
+inline void set_cpu_level(cpu_level level)
+{
+    const cpu_level detected = detected_cpu_level();
+    if (static_cast<int>(level) > static_cast<int>(detected))
+    {
+        level = detected;
+    }
+    detail::cpu_level_state().store(static_cast<int>(level),
+                                    std::memory_order_relaxed);
+}
+
+/// Makes the vectorized kernels use the level chosen at startup again.
+inline void reset_cpu_level()
+{
+    detail::cpu_level_state().store(
+        static_cast<int>(detail::initial_cpu_level()),
+        std::memory_order_relaxed);
+}
+}
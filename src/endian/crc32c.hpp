@@ -0,0 +1,112 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#include "cpu_features.hpp"
+#include "detail/crc32c.hpp"
+
+namespace endian
+{
+/// Computes the CRC32C (Castagnoli) checksum of a buffer, as used by iSCSI,
+/// SCTP and ext4. Uses the crc32 instruction of SSE4.2 when the CPU supports
+/// it.
+/// @param data pointer to the data
+/// @param size the number of bytes
+/// @param crc the checksum of the preceding data, to continue a checksum
+///        over several buffers
+/// @return the checksum
+inline uint32_t crc32c(const uint8_t* data, std::size_t size, uint32_t crc = 0)
+{
+    assert((size == 0 || data != nullptr) && "Nullpointer provided");
+
+    const auto update = detail::select_crc32c(active_cpu_level());
+    return ~update(~crc, data, size);
+}
+
+/// Checksum policy for the stream_reader and stream_writer which folds every
+/// byte read, written or skipped into a CRC32C. The stream_writer appends the
+/// checksum with write_checksum() and the stream_reader compares it with
+/// verify_checksum().
+///
+/// Consecutive reads and writes are collected into runs of up to
+/// batch_size bytes, which are folded in while they are still in the L1
+/// cache. This keeps the cost of small values to a comparison and an
+/// addition, and lets the kernel work on whole 8 byte words.
+///
+/// The collected run is folded in before the stream seeks, so bytes are
+/// counted as they were when the stream moved past them. Bytes overwritten
+/// after a seek, e.g. a length field patched in after the payload, are
+/// counted again with their new value and the old value stays in the
+/// checksum.
+///
+/// The kernel is chosen when the stream is created, so later changes to the
+/// CPU level do not affect it.
+class crc32c_checksum
+{
+public:
+    /// True since this policy computes a checksum
+    static constexpr bool has_checksum = true;
+
+    /// The largest number of bytes collected before they are folded in
+    static constexpr std::size_t batch_size = 4096;
+
+    /// @return the CRC32C of the bytes passed since the stream was created
+    ///         or the checksum was last reset
+    uint32_t checksum() const noexcept
+    {
+        return ~m_update(m_crc, m_pending, m_pending_size);
+    }
+
+    /// Starts a new checksum
+    void reset_checksum() noexcept
+    {
+        m_crc = 0xFFFFFFFF;
+        m_pending_size = 0;
+    }
+
+protected:
+    /// Adds bytes to the checksum.
+    /// @param data pointer to the bytes
+    /// @param size the number of bytes
+    void update_checksum(const uint8_t* data, std::size_t size) noexcept
+    {
+        if (data == m_pending + m_pending_size &&
+            m_pending_size + size <= batch_size)
+        {
+            m_pending_size += size;
+            return;
+        }
+
+        m_crc = m_update(m_crc, m_pending, m_pending_size);
+        m_pending = data;
+        m_pending_size = size;
+    }
+
+    /// Folds the collected bytes into the checksum, so they are counted as
+    /// they are now. Called before the stream moves to another position.
+    void fold_checksum() noexcept
+    {
+        m_crc = m_update(m_crc, m_pending, m_pending_size);
+        m_pending = nullptr;
+        m_pending_size = 0;
+    }
+
+private:
+    /// The CRC register before the final inversion, without the pending
+    /// bytes
+    uint32_t m_crc = 0xFFFFFFFF;
+
+    /// The run of bytes not yet folded in
+    const uint8_t* m_pending = nullptr;
+    std::size_t m_pending_size = 0;
+
+    /// The kernel for the CPU
+    detail::crc32c_kernel m_update = detail::select_crc32c(active_cpu_level());
+};
+}
@@ -11,6 +11,7 @@
 #include <limits>
 #include <type_traits>
 
+#include "byte_swap.hpp"
 #include "helpers.hpp"
 
 namespace endian
@@ -53,11 +54,69 @@ struct big_impl<ValueType, 1>
     }
 };
 
+// Selects the conversion for a Bytes-sized value. Values filling the whole
+// ValueType are converted with a single memory access, using a byte swap when
+// the host byte order differs. All other widths use the portable big_impl.
+template <class ValueType, uint8_t Bytes,
+          bool IsFullWidth = (Bytes == sizeof(ValueType) && Bytes > 1)>
+struct big_convert
+{
+    static void put(ValueType& value, uint8_t* buffer)
+    {
+        big_impl<ValueType, Bytes>::put(value, buffer);
+    }
+
+    static void get(ValueType& value, const uint8_t* buffer)
+    {
+        big_impl<ValueType, Bytes>::get(value, buffer);
+    }
+};
+
+template <class ValueType, uint8_t Bytes>
+struct big_convert<ValueType, Bytes, true>
+{
+    static void put(ValueType& value, uint8_t* buffer)
+    {
+        full_width<ValueType, byte_order::big>::put(value, buffer);
+    }
+
+    static void get(ValueType& value, const uint8_t* buffer)
+    {
+        full_width<ValueType, byte_order::big>::get(value, buffer);
+    }
+};
+
+#if defined(ENDIAN_INT128)
+// Widths between 9 and 15 bytes of a 128 bit integer. The low 8 bytes are a
+// single 64 bit access, stored as the low 8 bytes last, so only the
+// remaining high bytes are converted one at a time.
+template <uint8_t Bytes>
+struct big_convert<uint128_t, Bytes, false>
+{
+    static void put(uint128_t& value, uint8_t* buffer)
+    {
+        uint64_t high = static_cast<uint64_t>(value >> 64);
+        big_impl<uint64_t, Bytes - 8>::put(high, buffer);
+        full_width<uint64_t, byte_order::big>::put(
+            static_cast<uint64_t>(value), buffer + Bytes - 8);
+    }
+
+    static void get(uint128_t& value, const uint8_t* buffer)
+    {
+        uint64_t high = 0;
+        uint64_t low = 0;
+        big_impl<uint64_t, Bytes - 8>::get(high, buffer);
+        full_width<uint64_t, byte_order::big>::get(low, buffer + Bytes - 8);
+        value = (static_cast<uint128_t>(high) << 64) | low;
+    }
+};
+#endif
+
 // Helper to delegate to the appropiate specialization depending on the type
 // @TODO remove these wrappers when we have CXX17 support and "if constexpr"
 template <class ValueType, uint8_t Bytes,
-          bool IsUnsigened = std::is_unsigned<ValueType>::value,
-          bool IsFloat = std::is_floating_point<ValueType>::value>
+          bool IsUnsigened = is_unsigned<ValueType>::value,
+          bool IsFloat = is_floating<ValueType>::value>
 struct big
 {
     static void put(ValueType& value, uint8_t* buffer)
@@ -85,12 +144,12 @@ struct big<ValueType, Bytes, true, false>
         assert((check<ValueType, Bytes>::value(value)) &&
                "Value too big to fit in the provided bytes");
 
-        big_impl<ValueType, Bytes>::put(value, buffer);
+        big_convert<ValueType, Bytes>::put(value, buffer);
     }
 
     static void get(ValueType& value, const uint8_t* buffer)
     {
-        big_impl<ValueType, Bytes>::get(value, buffer);
+        big_convert<ValueType, Bytes>::get(value, buffer);
     }
 };
 
@@ -103,12 +162,12 @@ struct big<ValueType, Bytes, false, false>
 
     static void put(ValueType& value, uint8_t* buffer)
     {
-        big_impl<ValueType, Bytes>::put(value, buffer);
+        big_convert<ValueType, Bytes>::put(value, buffer);
     }
 
     static void get(ValueType& value, const uint8_t* buffer)
     {
-        big_impl<ValueType, Bytes>::get(value, buffer);
+        big_convert<ValueType, Bytes>::get(value, buffer);
     }
 };
 
@@ -117,7 +176,7 @@ template <class ValueType, uint8_t Bytes>
 struct big<ValueType, Bytes, false, true>
 {
     static_assert(
-        std::numeric_limits<ValueType>::is_iec559,
+        floating_point<ValueType>::is_iec559,
         "Platform must be iec559 compliant when floating point types are used");
 
     static_assert(
@@ -128,14 +187,14 @@ struct big<ValueType, Bytes, false, true>
     {
         typename floating_point<ValueType>::UnsignedType temp = 0;
         memcpy(&temp, &value, sizeof(ValueType));
-        big_impl<decltype(temp), sizeof(ValueType)>::put(temp, buffer);
+        big_convert<decltype(temp), sizeof(ValueType)>::put(temp, buffer);
     }
 
     static void get(ValueType& value, const uint8_t* buffer)
     {
         typename floating_point<ValueType>::UnsignedType temp = 0;
-        big_impl<decltype(temp), sizeof(ValueType)>::get(temp, buffer);
-        memcpy(&value, &temp, sizeof(ValueType));
+        big_convert<decltype(temp), sizeof(ValueType)>::get(temp, buffer);
+        memcpy(static_cast<void*>(&value), &temp, sizeof(ValueType));
     }
 };
 
@@ -0,0 +1,120 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+
+#include "../big_endian.hpp"
+#include "../little_endian.hpp"
+#include "byte_swap.hpp"
+
+namespace endian
+{
+namespace detail
+{
+// Operations on a 64 bit accumulator holding the first bits of a stream in
+// its most significant bits. Used for big endian bit streams, where the
+// first bit of a byte is its most significant bit.
+struct msb_first
+{
+    static constexpr bool is_msb_first = true;
+
+    // Loads 8 bytes such that the first bit of the stream is the most
+    // significant bit
+    static uint64_t load(const uint8_t* data)
+    {
+        uint64_t word;
+        full_width<uint64_t, byte_order::big>::get(word, data);
+        return word;
+    }
+
+    // A single byte placed as the first bits of a word
+    static uint64_t byte(uint8_t value)
+    {
+        return static_cast<uint64_t>(value) << 56;
+    }
+
+    // Appends the bits of a word after the first count bits
+    static uint64_t append(uint64_t bits, uint32_t count, uint64_t word)
+    {
+        return bits | (word >> count);
+    }
+
+    // The first count bits, count may be 0 but not 64
+    static uint64_t first(uint64_t bits, uint32_t count)
+    {
+        return (bits >> 1) >> (63 - count);
+    }
+
+    // Removes the first count bits, count must be less than 64
+    static uint64_t remove(uint64_t bits, uint32_t count)
+    {
+        return bits << count;
+    }
+
+    // Places a count bit value after the first used bits
+    static uint64_t place(uint64_t value, uint32_t used, uint32_t count)
+    {
+        return (value << (64 - used - count));
+    }
+};
+
+// Operations on a 64 bit accumulator holding the first bits of a stream in
+// its least significant bits. Used for little endian bit streams, where the
+// first bit of a byte is its least significant bit.
+struct lsb_first
+{
+    static constexpr bool is_msb_first = false;
+
+    static uint64_t load(const uint8_t* data)
+    {
+        uint64_t word;
+        full_width<uint64_t, byte_order::little>::get(word, data);
+        return word;
+    }
+
+    static uint64_t byte(uint8_t value)
+    {
+        return value;
+    }
+
+    static uint64_t append(uint64_t bits, uint32_t count, uint64_t word)
+    {
+        return bits | (word << count);
+    }
+
+    static uint64_t first(uint64_t bits, uint32_t count)
+    {
+        return bits & ((1ULL << count) - 1);
+    }
+
+    static uint64_t remove(uint64_t bits, uint32_t count)
+    {
+        return bits >> count;
+    }
+
+    static uint64_t place(uint64_t value, uint32_t used, uint32_t count)
+    {
+        (void)count;
+        return value << used;
+    }
+};
+
+// Selects the bit order of an endian type
+template <class EndianType>
+struct bit_order;
+
+template <>
+struct bit_order<big_endian> : msb_first
+{
+};
+
+template <>
+struct bit_order<little_endian> : lsb_first
+{
+};
+}
+}
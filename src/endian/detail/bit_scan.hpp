@@ -0,0 +1,61 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <intrin.h>
+#endif
+
+namespace endian
+{
+namespace detail
+{
+// Counts the zero bits below the lowest set bit. The value must not be zero.
+inline uint32_t count_trailing_zeros(uint64_t value)
+{
+    assert(value != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_ctzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanForward64(&index, value);
+    return static_cast<uint32_t>(index);
+#else
+    uint32_t count = 0;
+    while ((value & 1) == 0)
+    {
+        value >>= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+
+// Counts the zero bits above the highest set bit. The value must not be zero.
+inline uint32_t count_leading_zeros(uint64_t value)
+{
+    assert(value != 0);
+#if defined(__GNUC__) || defined(__clang__)
+    return static_cast<uint32_t>(__builtin_clzll(value));
+#elif defined(_MSC_VER) && defined(_M_X64)
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return static_cast<uint32_t>(63 - index);
+#else
+    uint32_t count = 0;
+    while ((value & 0x8000000000000000ULL) == 0)
+    {
+        value <<= 1;
+        ++count;
+    }
+    return count;
+#endif
+}
+}
+}
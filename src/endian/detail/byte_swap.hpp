@@ -0,0 +1,220 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "../is_big_endian.hpp"
+#include "int128.hpp"
+
+#if defined(_MSC_VER) && !defined(__clang__)
+#include <stdlib.h>
+#endif
+
+namespace endian
+{
+namespace detail
+{
+
+// Reverses the byte order of an integer. These map to a single bswap, rev or
+// movbe instruction on the compilers which provide byte swap intrinsics.
+inline uint16_t byte_swap(uint16_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap16(value);
+#elif defined(_MSC_VER)
+    return _byteswap_ushort(value);
+#else
+    return static_cast<uint16_t>((value << 8) | (value >> 8));
+#endif
+}
+
+inline uint32_t byte_swap(uint32_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap32(value);
+#elif defined(_MSC_VER)
+    return _byteswap_ulong(value);
+#else
+    return ((value & 0x000000FFU) << 24) | ((value & 0x0000FF00U) << 8) |
+           ((value & 0x00FF0000U) >> 8) | ((value & 0xFF000000U) >> 24);
+#endif
+}
+
+inline uint64_t byte_swap(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return __builtin_bswap64(value);
+#elif defined(_MSC_VER)
+    return _byteswap_uint64(value);
+#else
+    return (static_cast<uint64_t>(byte_swap(static_cast<uint32_t>(value)))
+            << 32) |
+           byte_swap(static_cast<uint32_t>(value >> 32));
+#endif
+}
+
+#if defined(ENDIAN_INT128)
+// Reverses a 128 bit integer as two 64 bit halves, i.e. two bswap or movbe
+// instructions
+inline uint128_t byte_swap(uint128_t value)
+{
+    return (static_cast<uint128_t>(byte_swap(static_cast<uint64_t>(value)))
+            << 64) |
+           byte_swap(static_cast<uint64_t>(value >> 64));
+}
+#endif
+
+// Helper to get the unsigned integer type of a given size in bytes
+template <uint8_t Bytes>
+struct unsigned_type
+{
+};
+
+template <>
+struct unsigned_type<1>
+{
+    using type = uint8_t;
+};
+
+template <>
+struct unsigned_type<2>
+{
+    using type = uint16_t;
+};
+
+template <>
+struct unsigned_type<4>
+{
+    using type = uint32_t;
+};
+
+template <>
+struct unsigned_type<8>
+{
+    using type = uint64_t;
+};
+
+#if defined(ENDIAN_INT128)
+template <>
+struct unsigned_type<16>
+{
+    using type = uint128_t;
+};
+#endif
+
+// Stores and loads full-width values in the byte order of the host, using a
+// single unaligned memory access
+template <class ValueType>
+struct native_order
+{
+    static void put(const ValueType& value, uint8_t* buffer)
+    {
+        memcpy(buffer, &value, sizeof(ValueType));
+    }
+
+    static void get(ValueType& value, const uint8_t* buffer)
+    {
+        memcpy(&value, buffer, sizeof(ValueType));
+    }
+};
+
+// Stores and loads full-width values in the reverse byte order of the host,
+// using a single unaligned memory access and a byte swap
+template <class ValueType>
+struct swapped_order
+{
+    using UnsignedType = typename unsigned_type<sizeof(ValueType)>::type;
+
+    static void put(const ValueType& value, uint8_t* buffer)
+    {
+        UnsignedType temp;
+        memcpy(&temp, &value, sizeof(ValueType));
+        temp = byte_swap(temp);
+        memcpy(buffer, &temp, sizeof(ValueType));
+    }
+
+    static void get(ValueType& value, const uint8_t* buffer)
+    {
+        UnsignedType temp;
+        memcpy(&temp, buffer, sizeof(ValueType));
+        temp = byte_swap(temp);
+        memcpy(&value, &temp, sizeof(ValueType));
+    }
+};
+
+// Stores and loads full-width values in the Order byte order. When the host
+// byte order is known at compile time this is either a plain copy or a single
+// byte swap, without any runtime check.
+template <class ValueType, byte_order Order, byte_order Host = host_byte_order>
+struct full_width : swapped_order<ValueType>
+{
+};
+
+template <class ValueType, byte_order Order>
+struct full_width<ValueType, Order, Order> : native_order<ValueType>
+{
+};
+
+template <class ValueType>
+struct full_width<ValueType, byte_order::big, byte_order::unknown>
+{
+    static void put(const ValueType& value, uint8_t* buffer)
+    {
+        if (is_big_endian())
+        {
+            native_order<ValueType>::put(value, buffer);
+        }
+        else
+        {
+            swapped_order<ValueType>::put(value, buffer);
+        }
+    }
+
+    static void get(ValueType& value, const uint8_t* buffer)
+    {
+        if (is_big_endian())
+        {
+            native_order<ValueType>::get(value, buffer);
+        }
+        else
+        {
+            swapped_order<ValueType>::get(value, buffer);
+        }
+    }
+};
+
+template <class ValueType>
+struct full_width<ValueType, byte_order::little, byte_order::unknown>
+{
+    static void put(const ValueType& value, uint8_t* buffer)
+    {
+        if (is_big_endian())
+        {
+            swapped_order<ValueType>::put(value, buffer);
+        }
+        else
+        {
+            native_order<ValueType>::put(value, buffer);
+        }
+    }
+
+    static void get(ValueType& value, const uint8_t* buffer)
+    {
+        if (is_big_endian())
+        {
+            swapped_order<ValueType>::get(value, buffer);
+        }
+        else
+        {
+            native_order<ValueType>::get(value, buffer);
+        }
+    }
+};
+
+}
+}
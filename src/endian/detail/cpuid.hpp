@@ -0,0 +1,123 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+
+// The vectorized kernels are compiled for every instruction set on x86-64 and
+// the fastest one supported by the CPU is chosen at runtime. Each kernel is
+// marked with the instruction set it uses, so the rest of the program can be
+// built for the baseline x86-64 target.
+#if (defined(__x86_64__) || defined(_M_X64)) &&                               \
+    (defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER))
+#define ENDIAN_RUNTIME_DISPATCH 1
+#endif
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+#if defined(__GNUC__) || defined(__clang__)
+#include <cpuid.h>
+#define ENDIAN_TARGET(isa) __attribute__((target(isa)))
+#else
+#include <immintrin.h>
+#include <intrin.h>
+// MSVC allows every intrinsic in every function
+#define ENDIAN_TARGET(isa)
+#endif
+#endif
+
+namespace endian
+{
+namespace detail
+{
+// The instruction set extensions reported by the CPU and enabled by the
+// operating system
+struct cpuid_features
+{
+    bool sse2 = false;
+    bool ssse3 = false;
+    bool sse42 = false;
+    bool avx2 = false;
+    bool avx512bw = false;
+    bool bmi2 = false;
+    bool movbe = false;
+    bool f16c = false;
+};
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+inline void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t* registers)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    __cpuid_count(leaf, subleaf, registers[0], registers[1], registers[2],
+                  registers[3]);
+#else
+    int info[4];
+    __cpuidex(info, static_cast<int>(leaf), static_cast<int>(subleaf));
+    for (int i = 0; i < 4; ++i)
+    {
+        registers[i] = static_cast<uint32_t>(info[i]);
+    }
+#endif
+}
+
+// The register state saved by the operating system on context switches
+inline uint64_t xgetbv()
+{
+#if defined(__GNUC__) || defined(__clang__)
+    uint32_t eax = 0;
+    uint32_t edx = 0;
+    __asm__ volatile("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+    return (static_cast<uint64_t>(edx) << 32) | eax;
+#else
+    return _xgetbv(0);
+#endif
+}
+
+inline cpuid_features detect_cpuid_features()
+{
+    cpuid_features features;
+    uint32_t registers[4] = {0, 0, 0, 0};
+
+    cpuid(0, 0, registers);
+    const uint32_t max_leaf = registers[0];
+    if (max_leaf < 1)
+    {
+        return features;
+    }
+
+    cpuid(1, 0, registers);
+    features.sse2 = (registers[3] >> 26) & 1;
+    features.ssse3 = (registers[2] >> 9) & 1;
+    features.sse42 = (registers[2] >> 20) & 1;
+    features.movbe = (registers[2] >> 22) & 1;
+    const bool osxsave = (registers[2] >> 27) & 1;
+    const bool avx = (registers[2] >> 28) & 1;
+    const bool f16c = (registers[2] >> 29) & 1;
+
+    // The wide registers can only be used if the operating system saves
+    // them, which is reported in XCR0
+    const uint64_t xcr0 = osxsave ? xgetbv() : 0;
+    const bool ymm_state = (xcr0 & 0x6) == 0x6;
+    const bool zmm_state = (xcr0 & 0xE6) == 0xE6;
+    features.f16c = avx && ymm_state && f16c;
+
+    if (max_leaf >= 7)
+    {
+        cpuid(7, 0, registers);
+        features.avx2 = avx && ymm_state && ((registers[1] >> 5) & 1);
+        features.bmi2 = (registers[1] >> 8) & 1;
+        features.avx512bw = zmm_state && ((registers[1] >> 16) & 1) &&
+                            ((registers[1] >> 30) & 1);
+    }
+    return features;
+}
+#else
+inline cpuid_features detect_cpuid_features()
+{
+    return cpuid_features();
+}
+#endif
+}
+}
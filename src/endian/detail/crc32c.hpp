@@ -0,0 +1,220 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "../cpu_features.hpp"
+#include "cpuid.hpp"
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+#include <immintrin.h>
+#endif
+
+namespace endian
+{
+namespace detail
+{
+// The length of each of the three blocks the crc32 instruction works on in
+// parallel
+constexpr std::size_t crc32c_block = 256;
+
+// The lookup tables of the slicing-by-8 CRC32C, using the reflected
+// Castagnoli polynomial. Table k holds the CRC of a byte followed by k zero
+// bytes, so eight bytes are folded in with eight independent lookups.
+//
+// The shift tables move a CRC register past crc32c_block zero bytes, which
+// combines the CRCs of adjacent blocks.
+struct crc32c_tables
+{
+    crc32c_tables()
+    {
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            uint32_t crc = i;
+            for (int bit = 0; bit < 8; ++bit)
+            {
+                crc = (crc >> 1) ^ ((crc & 1) ? 0x82F63B78 : 0);
+            }
+            table[0][i] = crc;
+        }
+        for (uint32_t i = 0; i < 256; ++i)
+        {
+            for (int k = 1; k < 8; ++k)
+            {
+                const uint32_t previous = table[k - 1][i];
+                table[k][i] = (previous >> 8) ^ table[0][previous & 0xFF];
+            }
+        }
+
+        // Moving past zeros is linear, so it is found for each bit of the
+        // register and combined for each byte value
+        uint32_t bits[32];
+        for (int bit = 0; bit < 32; ++bit)
+        {
+            uint32_t crc = 1U << bit;
+            for (std::size_t i = 0; i < crc32c_block; ++i)
+            {
+                crc = (crc >> 8) ^ table[0][crc & 0xFF];
+            }
+            bits[bit] = crc;
+        }
+        for (int k = 0; k < 4; ++k)
+        {
+            for (uint32_t i = 0; i < 256; ++i)
+            {
+                uint32_t crc = 0;
+                for (int bit = 0; bit < 8; ++bit)
+                {
+                    crc ^= ((i >> bit) & 1) ? bits[k * 8 + bit] : 0;
+                }
+                shift[k][i] = crc;
+            }
+        }
+    }
+
+    uint32_t table[8][256];
+    uint32_t shift[4][256];
+};
+
+inline const crc32c_tables& crc32c_table()
+{
+    static const crc32c_tables tables;
+    return tables;
+}
+
+// The CRC works on the bytes in memory order, so the words are assembled
+// the same way on every host
+inline uint32_t crc32c_load(const uint8_t* data)
+{
+    return static_cast<uint32_t>(data[0]) |
+           (static_cast<uint32_t>(data[1]) << 8) |
+           (static_cast<uint32_t>(data[2]) << 16) |
+           (static_cast<uint32_t>(data[3]) << 24);
+}
+
+// Folds a number of bytes into the CRC state, which is the CRC register
+// before the final inversion
+inline uint32_t crc32c_update_scalar(uint32_t crc, const uint8_t* data,
+                                     std::size_t size)
+{
+    const auto& t = crc32c_table().table;
+    for (; size >= 8; size -= 8, data += 8)
+    {
+        const uint32_t low = crc ^ crc32c_load(data);
+        const uint32_t high = crc32c_load(data + 4);
+        crc = t[7][low & 0xFF] ^ t[6][(low >> 8) & 0xFF] ^
+              t[5][(low >> 16) & 0xFF] ^ t[4][low >> 24] ^
+              t[3][high & 0xFF] ^ t[2][(high >> 8) & 0xFF] ^
+              t[1][(high >> 16) & 0xFF] ^ t[0][high >> 24];
+    }
+    if (size >= 4)
+    {
+        const uint32_t word = crc ^ crc32c_load(data);
+        crc = t[3][word & 0xFF] ^ t[2][(word >> 8) & 0xFF] ^
+              t[1][(word >> 16) & 0xFF] ^ t[0][word >> 24];
+        data += 4;
+        size -= 4;
+    }
+    for (; size != 0; --size, ++data)
+    {
+        crc = (crc >> 8) ^ t[0][(crc ^ *data) & 0xFF];
+    }
+    return crc;
+}
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+// The crc32 instruction of SSE4.2 computes CRC32C, eight bytes at a time.
+// It has a latency of three cycles but a throughput of one per cycle, so long
+// inputs are split into three blocks worked on in parallel and combined with
+// the shift tables.
+ENDIAN_TARGET("sse4.2")
+inline uint32_t crc32c_update_sse42(uint32_t crc, const uint8_t* data,
+                                    std::size_t size)
+{
+    uint64_t state = crc;
+    if (size >= 3 * crc32c_block)
+    {
+        const auto& shift = crc32c_table().shift;
+        for (; size >= 3 * crc32c_block;
+             size -= 3 * crc32c_block, data += 3 * crc32c_block)
+        {
+            uint64_t second = 0;
+            uint64_t third = 0;
+            for (std::size_t i = 0; i < crc32c_block; i += 8)
+            {
+                uint64_t words[3];
+                memcpy(&words[0], data + i, 8);
+                memcpy(&words[1], data + crc32c_block + i, 8);
+                memcpy(&words[2], data + 2 * crc32c_block + i, 8);
+                state = _mm_crc32_u64(state, words[0]);
+                second = _mm_crc32_u64(second, words[1]);
+                third = _mm_crc32_u64(third, words[2]);
+            }
+            const uint64_t blocks[] = {second, third};
+            for (uint64_t next : blocks)
+            {
+                state = shift[0][state & 0xFF] ^ shift[1][(state >> 8) & 0xFF] ^
+                        shift[2][(state >> 16) & 0xFF] ^
+                        shift[3][(state >> 24) & 0xFF] ^ next;
+            }
+        }
+    }
+    for (; size >= 8; size -= 8, data += 8)
+    {
+        uint64_t word;
+        memcpy(&word, data, sizeof(word));
+        state = _mm_crc32_u64(state, word);
+    }
+    crc = static_cast<uint32_t>(state);
+
+    // Stream writes are mostly a few bytes, so the tail is folded in at most
+    // three steps
+    if (size >= 4)
+    {
+        uint32_t word;
+        memcpy(&word, data, sizeof(word));
+        crc = _mm_crc32_u32(crc, word);
+        data += 4;
+        size -= 4;
+    }
+    if (size >= 2)
+    {
+        uint16_t half;
+        memcpy(&half, data, sizeof(half));
+        crc = _mm_crc32_u16(crc, half);
+        data += 2;
+        size -= 2;
+    }
+    if (size != 0)
+    {
+        crc = _mm_crc32_u8(crc, *data);
+    }
+    return crc;
+}
+#endif
+
+using crc32c_kernel = uint32_t (*)(uint32_t, const uint8_t*, std::size_t);
+
+// The CRC32C kernel used at the given CPU level. The crc32 instruction is
+// used from the SSSE3 level when the CPU has SSE4.2, so lowering the level
+// to sse2 or scalar selects the table driven version.
+inline crc32c_kernel select_crc32c(cpu_level level)
+{
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+    if (static_cast<int>(level) >= static_cast<int>(cpu_level::ssse3) &&
+        detected_cpu_features().sse42)
+    {
+        return crc32c_update_sse42;
+    }
+#else
+    (void)level;
+#endif
+    return crc32c_update_scalar;
+}
+}
+}
@@ -0,0 +1,56 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace endian
+{
+namespace detail
+{
+// Helper to find the index of Field in a list of fields
+template <class Field, class... Fields>
+struct field_index;
+
+template <class Field>
+struct field_index<Field>
+{
+    static_assert(!std::is_same<Field, Field>::value,
+                  "The field is not part of the layout");
+};
+
+template <class Field, class... Fields>
+struct field_index<Field, Field, Fields...>
+    : std::integral_constant<std::size_t, 0>
+{
+};
+
+template <class Field, class Other, class... Fields>
+struct field_index<Field, Other, Fields...>
+    : std::integral_constant<std::size_t,
+                             1 + field_index<Field, Fields...>::value>
+{
+};
+
+// Helper to sum the widths of the first Count fields in a list of fields
+template <std::size_t Count, class... Fields>
+struct field_offset : std::integral_constant<std::size_t, 0>
+{
+};
+
+template <std::size_t Count, class Field, class... Fields>
+struct field_offset<Count, Field, Fields...>
+    : std::integral_constant<
+          std::size_t,
+          Count == 0
+              ? 0
+              : Field::bytes +
+                    field_offset<(Count == 0 ? 0 : Count - 1), Fields...>::value>
+{
+};
+}
+}
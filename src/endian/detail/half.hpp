@@ -0,0 +1,443 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "../cpu_features.hpp"
+#include "byte_swap.hpp"
+#include "cpuid.hpp"
+#include "swap_array.hpp"
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+#include <immintrin.h>
+#endif
+
+namespace endian
+{
+namespace detail
+{
+inline uint32_t float_bits(float value)
+{
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+inline float bits_float(uint32_t bits)
+{
+    float value;
+    memcpy(&value, &bits, sizeof(value));
+    return value;
+}
+
+// Converts an IEEE 754 binary16 value to a float. The conversion is exact,
+// and signaling NaNs are made quiet like the F16C instructions do.
+inline float half_to_float(uint16_t half)
+{
+    const uint32_t sign = static_cast<uint32_t>(half & 0x8000) << 16;
+    const uint32_t exponent = half & 0x7C00;
+    uint32_t bits = static_cast<uint32_t>(half & 0x7FFF) << 13;
+
+    if (exponent == 0x7C00)
+    {
+        // Infinity or NaN
+        bits += (255 - 31) << 23;
+        if ((half & 0x3FF) != 0)
+        {
+            bits |= 0x400000;
+        }
+    }
+    else if (exponent == 0)
+    {
+        // Zero or subnormal, which is normalized by the float subtraction
+        bits += 113 << 23;
+        bits = float_bits(bits_float(bits) - bits_float(113 << 23));
+    }
+    else
+    {
+        bits += (127 - 15) << 23;
+    }
+    return bits_float(bits | sign);
+}
+
+// Converts a float to an IEEE 754 binary16 value, rounding to nearest even.
+// Values too large for binary16 become infinity, and NaNs keep the upper
+// bits of their payload and are made quiet like the F16C instructions do.
+inline uint16_t float_to_half(float value)
+{
+    uint32_t bits = float_bits(value);
+    const uint16_t sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+    bits &= 0x7FFFFFFF;
+
+    if (bits >= 0x7F800000)
+    {
+        // Infinity or NaN
+        const uint16_t payload =
+            bits > 0x7F800000 ? static_cast<uint16_t>(0x200 | (bits >> 13))
+                              : 0;
+        return static_cast<uint16_t>(sign | 0x7C00 | (payload & 0x3FF));
+    }
+    if (bits >= 0x47800000)
+    {
+        // At least 65536, which overflows to infinity
+        return static_cast<uint16_t>(sign | 0x7C00);
+    }
+    if (bits < 0x38800000)
+    {
+        // Below the smallest normal binary16 value. Adding 0.5 aligns the
+        // mantissa so the float addition does the rounding.
+        bits = float_bits(bits_float(bits) + 0.5f) - 0x3F000000;
+        return static_cast<uint16_t>(sign | bits);
+    }
+
+    // Rebias the exponent and round to nearest even. A carry out of the
+    // mantissa correctly moves on to the next exponent or to infinity.
+    const uint32_t odd = (bits >> 13) & 1;
+    bits += 0xC8000FFF + odd;
+    return static_cast<uint16_t>(sign | (bits >> 13));
+}
+
+// Converts a bfloat16 value to a float, which only extends the mantissa
+inline float bfloat16_to_float(uint16_t bfloat)
+{
+    return bits_float(static_cast<uint32_t>(bfloat) << 16);
+}
+
+// Converts a float to a bfloat16 value, rounding to nearest even. NaNs are
+// made quiet, so they do not turn into infinity when the payload is cut.
+inline uint16_t float_to_bfloat16(float value)
+{
+    const uint32_t bits = float_bits(value);
+    if ((bits & 0x7FFFFFFF) > 0x7F800000)
+    {
+        return static_cast<uint16_t>((bits >> 16) | 0x40);
+    }
+    return static_cast<uint16_t>((bits + 0x7FFF + ((bits >> 16) & 1)) >> 16);
+}
+
+// The half precision formats, used to select the conversion kernels
+enum class half_format
+{
+    binary16,
+    bfloat16
+};
+
+template <half_format Format>
+struct half_convert;
+
+template <>
+struct half_convert<half_format::binary16>
+{
+    static float widen(uint16_t half)
+    {
+        return half_to_float(half);
+    }
+
+    static uint16_t narrow(float value)
+    {
+        return float_to_half(value);
+    }
+};
+
+template <>
+struct half_convert<half_format::bfloat16>
+{
+    static float widen(uint16_t half)
+    {
+        return bfloat16_to_float(half);
+    }
+
+    static uint16_t narrow(float value)
+    {
+        return float_to_bfloat16(value);
+    }
+};
+
+// Converts the stored values one at a time, reversing the byte order of each
+// value first when Swap is set
+template <half_format Format, bool Swap>
+inline void widen_array_scalar(float* values, const uint8_t* buffer,
+                               std::size_t elements)
+{
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        uint16_t half;
+        memcpy(&half, buffer + i * 2, 2);
+        values[i] = half_convert<Format>::widen(Swap ? byte_swap(half) : half);
+    }
+}
+
+template <half_format Format, bool Swap>
+inline void narrow_array_scalar(uint8_t* buffer, const float* values,
+                                std::size_t elements)
+{
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        uint16_t half = half_convert<Format>::narrow(values[i]);
+        half = Swap ? byte_swap(half) : half;
+        memcpy(buffer + i * 2, &half, 2);
+    }
+}
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+// The vector kernels convert eight or sixteen values at a time. The byte
+// order is reversed with a shuffle on the 16 bit values, so widening from
+// big endian data is still a single pass over the buffer.
+template <bool Swap>
+ENDIAN_TARGET("avx2")
+__m256i swap_halves_avx2(__m256i halves)
+{
+    return Swap ? _mm256_shuffle_epi8(
+                      halves, _mm256_broadcastsi128_si256(swap_mask<2>()))
+                : halves;
+}
+
+template <bool Swap>
+ENDIAN_TARGET("avx2")
+__m128i swap_halves_avx2(__m128i halves)
+{
+    return Swap ? _mm_shuffle_epi8(halves, swap_mask<2>()) : halves;
+}
+
+template <bool Swap>
+ENDIAN_TARGET("avx2,f16c")
+void widen_binary16_avx2(float* values, const uint8_t* buffer,
+                         std::size_t elements)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= elements; i += 8)
+    {
+        const __m128i halves = swap_halves_avx2<Swap>(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(buffer + i * 2)));
+        _mm256_storeu_ps(values + i, _mm256_cvtph_ps(halves));
+    }
+    widen_array_scalar<half_format::binary16, Swap>(values + i, buffer + i * 2,
+                                                    elements - i);
+}
+
+template <bool Swap>
+ENDIAN_TARGET("avx2,f16c")
+void narrow_binary16_avx2(uint8_t* buffer, const float* values,
+                          std::size_t elements)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= elements; i += 8)
+    {
+        const __m128i halves = _mm256_cvtps_ph(
+            _mm256_loadu_ps(values + i),
+            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(buffer + i * 2),
+                         swap_halves_avx2<Swap>(halves));
+    }
+    narrow_array_scalar<half_format::binary16, Swap>(buffer + i * 2,
+                                                     values + i, elements - i);
+}
+
+template <bool Swap>
+ENDIAN_TARGET("avx2")
+void widen_bfloat16_avx2(float* values, const uint8_t* buffer,
+                         std::size_t elements)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= elements; i += 8)
+    {
+        const __m128i halves = swap_halves_avx2<Swap>(_mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(buffer + i * 2)));
+        const __m256i bits =
+            _mm256_slli_epi32(_mm256_cvtepu16_epi32(halves), 16);
+        _mm256_storeu_ps(values + i, _mm256_castsi256_ps(bits));
+    }
+    widen_array_scalar<half_format::bfloat16, Swap>(values + i, buffer + i * 2,
+                                                    elements - i);
+}
+
+// Rounds the floats to the upper 16 bits, see float_to_bfloat16
+ENDIAN_TARGET("avx2")
+inline __m256i round_bfloat16_avx2(__m256 values)
+{
+    const __m256i bits = _mm256_castps_si256(values);
+    const __m256i odd = _mm256_and_si256(_mm256_srli_epi32(bits, 16),
+                                         _mm256_set1_epi32(1));
+    const __m256i rounded = _mm256_add_epi32(
+        bits, _mm256_add_epi32(odd, _mm256_set1_epi32(0x7FFF)));
+    const __m256i quiet = _mm256_or_si256(bits, _mm256_set1_epi32(0x400000));
+    const __m256i nan =
+        _mm256_castps_si256(_mm256_cmp_ps(values, values, _CMP_UNORD_Q));
+    return _mm256_srli_epi32(_mm256_blendv_epi8(rounded, quiet, nan), 16);
+}
+
+template <bool Swap>
+ENDIAN_TARGET("avx2")
+void narrow_bfloat16_avx2(uint8_t* buffer, const float* values,
+                          std::size_t elements)
+{
+    std::size_t i = 0;
+    for (; i + 8 <= elements; i += 8)
+    {
+        const __m256i rounded = round_bfloat16_avx2(_mm256_loadu_ps(values + i));
+
+        // The pack works within each 128 bit lane, so the halves of the two
+        // lanes are gathered in the low lane afterwards
+        const __m256i packed = _mm256_permute4x64_epi64(
+            _mm256_packus_epi32(rounded, rounded), 0x08);
+        _mm_storeu_si128(
+            reinterpret_cast<__m128i*>(buffer + i * 2),
+            swap_halves_avx2<Swap>(_mm256_castsi256_si128(packed)));
+    }
+    narrow_array_scalar<half_format::bfloat16, Swap>(buffer + i * 2,
+                                                     values + i, elements - i);
+}
+
+// The AVX-512 kernels use the zero-masking forms of the intrinsics, as the
+// unmasked forms give false uninitialized warnings in some versions of GCC
+template <bool Swap>
+ENDIAN_TARGET("avx512f,avx512bw,avx2,f16c")
+void widen_binary16_avx512(float* values, const uint8_t* buffer,
+                           std::size_t elements)
+{
+    std::size_t i = 0;
+    for (; i + 16 <= elements; i += 16)
+    {
+        const __m256i halves = swap_halves_avx2<Swap>(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(buffer + i * 2)));
+        _mm512_storeu_ps(values + i, _mm512_maskz_cvtph_ps(0xFFFF, halves));
+    }
+    widen_binary16_avx2<Swap>(values + i, buffer + i * 2, elements - i);
+}
+
+template <bool Swap>
+ENDIAN_TARGET("avx512f,avx512bw,avx2,f16c")
+void narrow_binary16_avx512(uint8_t* buffer, const float* values,
+                            std::size_t elements)
+{
+    std::size_t i = 0;
+    for (; i + 16 <= elements; i += 16)
+    {
+        const __m256i halves = _mm512_maskz_cvtps_ph(
+            0xFFFF, _mm512_loadu_ps(values + i),
+            _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(buffer + i * 2),
+                            swap_halves_avx2<Swap>(halves));
+    }
+    narrow_binary16_avx2<Swap>(buffer + i * 2, values + i, elements - i);
+}
+
+template <bool Swap>
+ENDIAN_TARGET("avx512f,avx512bw,avx2")
+void widen_bfloat16_avx512(float* values, const uint8_t* buffer,
+                           std::size_t elements)
+{
+    std::size_t i = 0;
+    for (; i + 16 <= elements; i += 16)
+    {
+        const __m256i halves = swap_halves_avx2<Swap>(_mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(buffer + i * 2)));
+        const __m512i bits = _mm512_maskz_slli_epi32(
+            0xFFFF, _mm512_maskz_cvtepu16_epi32(0xFFFF, halves), 16);
+        _mm512_storeu_ps(values + i, _mm512_castsi512_ps(bits));
+    }
+    widen_bfloat16_avx2<Swap>(values + i, buffer + i * 2, elements - i);
+}
+
+template <bool Swap>
+ENDIAN_TARGET("avx512f,avx512bw,avx2")
+void narrow_bfloat16_avx512(uint8_t* buffer, const float* values,
+                            std::size_t elements)
+{
+    std::size_t i = 0;
+    for (; i + 16 <= elements; i += 16)
+    {
+        const __m512 input = _mm512_loadu_ps(values + i);
+        const __m512i bits = _mm512_castps_si512(input);
+        const __m512i odd =
+            _mm512_and_si512(_mm512_maskz_srli_epi32(0xFFFF, bits, 16),
+                             _mm512_set1_epi32(1));
+        const __m512i rounded = _mm512_add_epi32(
+            bits, _mm512_add_epi32(odd, _mm512_set1_epi32(0x7FFF)));
+        const __m512i quiet =
+            _mm512_or_si512(bits, _mm512_set1_epi32(0x400000));
+        const __mmask16 nan = _mm512_cmp_ps_mask(input, input, _CMP_UNORD_Q);
+        const __m512i result = _mm512_maskz_srli_epi32(
+            0xFFFF, _mm512_mask_blend_epi32(nan, rounded, quiet), 16);
+        const __m256i halves = _mm512_maskz_cvtepi32_epi16(0xFFFF, result);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(buffer + i * 2),
+                            swap_halves_avx2<Swap>(halves));
+    }
+    narrow_bfloat16_avx2<Swap>(buffer + i * 2, values + i, elements - i);
+}
+#endif
+
+// Converts arrays of stored half precision values to and from floats,
+// reversing the byte order when Swap is set. The kernel for the active CPU
+// level is looked up in a table like for swap_array. The binary16 kernels
+// also need F16C, which every CPU with AVX2 has in practice.
+template <half_format Format, bool Swap>
+struct half_array
+{
+    using widen_kernel = void (*)(float*, const uint8_t*, std::size_t);
+    using narrow_kernel = void (*)(uint8_t*, const float*, std::size_t);
+
+    static void widen(float* values, const uint8_t* buffer,
+                      std::size_t elements)
+    {
+        select_widen(active_cpu_level())(values, buffer, elements);
+    }
+
+    static void narrow(uint8_t* buffer, const float* values,
+                       std::size_t elements)
+    {
+        select_narrow(active_cpu_level())(buffer, values, elements);
+    }
+
+    static widen_kernel select_widen(cpu_level level)
+    {
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+        static const widen_kernel kernels[] = {
+            widen_array_scalar<Format, Swap>, widen_array_scalar<Format, Swap>,
+            widen_array_scalar<Format, Swap>,
+            Format == half_format::binary16 ? widen_binary16_avx2<Swap>
+                                            : widen_bfloat16_avx2<Swap>,
+            Format == half_format::binary16 ? widen_binary16_avx512<Swap>
+                                            : widen_bfloat16_avx512<Swap>};
+        return vector_allowed(level) ? kernels[static_cast<int>(level)]
+                                     : kernels[0];
+#else
+        (void)level;
+        return widen_array_scalar<Format, Swap>;
+#endif
+    }
+
+    static narrow_kernel select_narrow(cpu_level level)
+    {
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+        static const narrow_kernel kernels[] = {
+            narrow_array_scalar<Format, Swap>,
+            narrow_array_scalar<Format, Swap>,
+            narrow_array_scalar<Format, Swap>,
+            Format == half_format::binary16 ? narrow_binary16_avx2<Swap>
+                                            : narrow_bfloat16_avx2<Swap>,
+            Format == half_format::binary16 ? narrow_binary16_avx512<Swap>
+                                            : narrow_bfloat16_avx512<Swap>};
+        return vector_allowed(level) ? kernels[static_cast<int>(level)]
+                                     : kernels[0];
+#else
+        (void)level;
+        return narrow_array_scalar<Format, Swap>;
+#endif
+    }
+
+private:
+    static bool vector_allowed(cpu_level level)
+    {
+        return Format != half_format::binary16 ||
+               static_cast<int>(level) < static_cast<int>(cpu_level::avx2) ||
+               detected_cpu_features().f16c;
+    }
+};
+}
+}
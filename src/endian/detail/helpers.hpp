@@ -6,6 +6,10 @@
 #pragma once
 
 #include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "int128.hpp"
 
 namespace endian
 {
@@ -70,6 +74,19 @@ struct check<ValueType, 7>
     }
 };
 
+#if defined(ENDIAN_INT128)
+// The widths above 8 bytes are only used with 128 bit integers. The shift is
+// kept below 128 bits for the full width, which always fits.
+template <uint8_t Bytes>
+struct check<uint128_t, Bytes>
+{
+    static bool value(uint128_t value)
+    {
+        return Bytes >= 16 || (value >> (Bytes % 16 * 8)) == 0;
+    }
+};
+#endif
+
 // Helper to convet floating point type into identically sized unsigned integer
 template <class Type>
 struct floating_point
@@ -81,6 +98,7 @@ struct floating_point<float>
 {
     static_assert(sizeof(float) == 4, "Float type must have a size of 4 bytes");
     using UnsignedType = uint32_t;
+    static constexpr bool is_iec559 = std::numeric_limits<float>::is_iec559;
 };
 
 template <>
@@ -89,6 +107,23 @@ struct floating_point<double>
     static_assert(sizeof(double) == 8,
                   "Float type must have a size of 8 bytes");
     using UnsignedType = uint64_t;
+    static constexpr bool is_iec559 = std::numeric_limits<double>::is_iec559;
+};
+
+// Helper to check if a type is stored through its floating_point
+// specialization. The half precision types in float16.hpp add themselves.
+template <class Type>
+struct is_floating : std::is_floating_point<Type>
+{
+};
+
+// Helper to check if a type is supported by the value conversions
+template <class Type>
+struct is_arithmetic
+    : std::integral_constant<bool, std::is_arithmetic<Type>::value ||
+                                       is_integer<Type>::value ||
+                                       is_floating<Type>::value>
+{
 };
 
 }
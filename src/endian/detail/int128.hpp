@@ -0,0 +1,56 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <type_traits>
+
+// The 128 bit integers are a compiler extension, available on the 64 bit
+// targets of GCC and Clang. ENDIAN_INT128 is defined when they can be used
+// with the converters.
+#if defined(__SIZEOF_INT128__)
+#define ENDIAN_INT128 1
+#endif
+
+namespace endian
+{
+namespace detail
+{
+#if defined(ENDIAN_INT128)
+// The extension keyword keeps -Wpedantic quiet about the types
+__extension__ typedef unsigned __int128 uint128_t;
+__extension__ typedef __int128 int128_t;
+#endif
+
+// Helpers to classify the integer types. Unlike the std traits they also
+// cover the 128 bit integers when compiling in strict ISO mode.
+template <class Type>
+struct is_unsigned : std::is_unsigned<Type>
+{
+};
+
+template <class Type>
+struct is_integer : std::is_integral<Type>
+{
+};
+
+#if defined(ENDIAN_INT128)
+template <>
+struct is_unsigned<uint128_t> : std::true_type
+{
+};
+
+template <>
+struct is_integer<uint128_t> : std::true_type
+{
+};
+
+template <>
+struct is_integer<int128_t> : std::true_type
+{
+};
+#endif
+}
+}
@@ -0,0 +1,508 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "../cpu_features.hpp"
+#include "../is_big_endian.hpp"
+#include "byte_swap.hpp"
+#include "cpuid.hpp"
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+#include <immintrin.h>
+#endif
+
+namespace endian
+{
+namespace detail
+{
+// Checks that Bytes is a width which is packed into a wider integer, i.e. 3
+// bytes for 32 bit values and 5 to 7 bytes for 64 bit values
+template <uint8_t Bytes, class ValueType>
+struct is_packed_width
+    : std::integral_constant<bool, std::is_integral<ValueType>::value &&
+                                       (sizeof(ValueType) == 4 ||
+                                        sizeof(ValueType) == 8) &&
+                                       (Bytes < sizeof(ValueType)) &&
+                                       (Bytes > sizeof(ValueType) / 2)>
+{
+};
+
+// The sign bit of a Bytes-sized value in every lane of a 64 bit word of
+// Size-byte lanes
+template <uint8_t Bytes, uint8_t Size>
+constexpr uint64_t packed_sign_bits()
+{
+    return Size == 4 ? ((uint64_t{1} << (Bytes * 8 - 1)) * 0x100000001ULL)
+                     : (uint64_t{1} << (Bytes * 8 - 1));
+}
+
+// Sign extends a Bytes-sized value without a branch, (value ^ m) - m with m
+// being the sign bit
+template <uint8_t Bytes, class ValueType>
+inline ValueType packed_extend(uint64_t value, std::true_type)
+{
+    using UnsignedType = typename std::make_unsigned<ValueType>::type;
+    const uint64_t sign = uint64_t{1} << (Bytes * 8 - 1);
+    return static_cast<ValueType>(
+        static_cast<UnsignedType>((value ^ sign) - sign));
+}
+
+template <uint8_t Bytes, class ValueType>
+inline ValueType packed_extend(uint64_t value, std::false_type)
+{
+    return static_cast<ValueType>(value);
+}
+
+// Unpacks the values one at a time. While 8 bytes can be read each value is
+// a single load and a shift or mask, the last values are read byte by byte.
+template <uint8_t Bytes, class ValueType, byte_order Order>
+inline void get_packed_scalar(ValueType* values, const uint8_t* input,
+                              std::size_t elements)
+{
+    const std::integral_constant<bool, std::is_signed<ValueType>::value>
+        sign;
+    std::size_t i = 0;
+    for (; (elements - i) * Bytes >= 8; ++i)
+    {
+        uint64_t word;
+        full_width<uint64_t, Order>::get(word, input + i * Bytes);
+        word = Order == byte_order::big
+                   ? word >> (64 - Bytes * 8)
+                   : word & ((uint64_t{1} << (Bytes * 8)) - 1);
+        values[i] = packed_extend<Bytes, ValueType>(word, sign);
+    }
+    for (; i < elements; ++i)
+    {
+        const uint8_t* data = input + i * Bytes;
+        uint64_t word = 0;
+        for (uint8_t k = 0; k < Bytes; ++k)
+        {
+            const uint8_t byte =
+                Order == byte_order::big ? data[k] : data[Bytes - 1 - k];
+            word = (word << 8) | byte;
+        }
+        values[i] = packed_extend<Bytes, ValueType>(word, sign);
+    }
+}
+
+// Packs the values one at a time. While 8 bytes can be written each value is
+// a single store, whose excess bytes are overwritten by the following values.
+template <uint8_t Bytes, class ValueType, byte_order Order>
+inline void put_packed_scalar(uint8_t* output, const ValueType* values,
+                              std::size_t elements)
+{
+    using UnsignedType = typename std::make_unsigned<ValueType>::type;
+    std::size_t i = 0;
+    for (; (elements - i) * Bytes >= 8; ++i)
+    {
+        uint64_t word = static_cast<UnsignedType>(values[i]);
+        if (Order == byte_order::big)
+        {
+            word <<= 64 - Bytes * 8;
+        }
+        full_width<uint64_t, Order>::put(word, output + i * Bytes);
+    }
+    for (; i < elements; ++i)
+    {
+        uint8_t* data = output + i * Bytes;
+        uint64_t word = static_cast<UnsignedType>(values[i]);
+        for (uint8_t k = 0; k < Bytes; ++k)
+        {
+            data[Order == byte_order::big ? Bytes - 1 - k : k] =
+                static_cast<uint8_t>(word);
+            word >>= 8;
+        }
+    }
+}
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+// Index of the packed byte that ends up at position j of a 16 byte lane of
+// Size-byte values, or -128 to clear the byte
+constexpr char unpack_index(uint8_t bytes, uint8_t size, bool big, int j)
+{
+    return j % size >= bytes
+               ? static_cast<char>(-128)
+               : static_cast<char>((j / size) * bytes +
+                                   (big ? bytes - 1 - j % size : j % size));
+}
+
+// Index of the byte of a 16 byte lane of Size-byte values that ends up at
+// position j of the packed bytes, or -128 past the packed bytes
+constexpr char pack_index(uint8_t bytes, uint8_t size, bool big, int j)
+{
+    return j / bytes >= 16 / size
+               ? static_cast<char>(-128)
+               : static_cast<char>((j / bytes) * size +
+                                   (big ? bytes - 1 - j % bytes : j % bytes));
+}
+
+template <uint8_t Bytes, uint8_t Size, bool Big>
+inline __m128i unpack_mask()
+{
+    return _mm_setr_epi8(
+        unpack_index(Bytes, Size, Big, 0), unpack_index(Bytes, Size, Big, 1),
+        unpack_index(Bytes, Size, Big, 2), unpack_index(Bytes, Size, Big, 3),
+        unpack_index(Bytes, Size, Big, 4), unpack_index(Bytes, Size, Big, 5),
+        unpack_index(Bytes, Size, Big, 6), unpack_index(Bytes, Size, Big, 7),
+        unpack_index(Bytes, Size, Big, 8), unpack_index(Bytes, Size, Big, 9),
+        unpack_index(Bytes, Size, Big, 10), unpack_index(Bytes, Size, Big, 11),
+        unpack_index(Bytes, Size, Big, 12), unpack_index(Bytes, Size, Big, 13),
+        unpack_index(Bytes, Size, Big, 14),
+        unpack_index(Bytes, Size, Big, 15));
+}
+
+template <uint8_t Bytes, uint8_t Size, bool Big>
+inline __m128i pack_mask()
+{
+    return _mm_setr_epi8(
+        pack_index(Bytes, Size, Big, 0), pack_index(Bytes, Size, Big, 1),
+        pack_index(Bytes, Size, Big, 2), pack_index(Bytes, Size, Big, 3),
+        pack_index(Bytes, Size, Big, 4), pack_index(Bytes, Size, Big, 5),
+        pack_index(Bytes, Size, Big, 6), pack_index(Bytes, Size, Big, 7),
+        pack_index(Bytes, Size, Big, 8), pack_index(Bytes, Size, Big, 9),
+        pack_index(Bytes, Size, Big, 10), pack_index(Bytes, Size, Big, 11),
+        pack_index(Bytes, Size, Big, 12), pack_index(Bytes, Size, Big, 13),
+        pack_index(Bytes, Size, Big, 14), pack_index(Bytes, Size, Big, 15));
+}
+
+// Sign extends the lanes with the sign bits m, (v ^ m) - m
+inline __m128i packed_extend(__m128i v, __m128i m,
+                             std::integral_constant<uint8_t, 4>)
+{
+    return _mm_sub_epi32(_mm_xor_si128(v, m), m);
+}
+
+inline __m128i packed_extend(__m128i v, __m128i m,
+                             std::integral_constant<uint8_t, 8>)
+{
+    return _mm_sub_epi64(_mm_xor_si128(v, m), m);
+}
+
+ENDIAN_TARGET("avx2")
+inline __m256i packed_extend(__m256i v, __m256i m,
+                             std::integral_constant<uint8_t, 4>)
+{
+    return _mm256_sub_epi32(_mm256_xor_si256(v, m), m);
+}
+
+ENDIAN_TARGET("avx2")
+inline __m256i packed_extend(__m256i v, __m256i m,
+                             std::integral_constant<uint8_t, 8>)
+{
+    return _mm256_sub_epi64(_mm256_xor_si256(v, m), m);
+}
+
+ENDIAN_TARGET("avx512bw")
+inline __m512i packed_extend(__m512i v, __m512i m,
+                             std::integral_constant<uint8_t, 4>)
+{
+    return _mm512_sub_epi32(_mm512_xor_si512(v, m), m);
+}
+
+ENDIAN_TARGET("avx512bw")
+inline __m512i packed_extend(__m512i v, __m512i m,
+                             std::integral_constant<uint8_t, 8>)
+{
+    return _mm512_sub_epi64(_mm512_xor_si512(v, m), m);
+}
+
+// The vector kernels work on 16 byte lanes, each holding the values unpacked
+// from a group of 16 / Size packed values. A lane is filled with a single
+// shuffle, and the sign is extended with two instructions for signed values.
+// The remainder is left to the narrower kernels and finally the scalar loop.
+template <uint8_t Bytes, class ValueType, byte_order Order>
+ENDIAN_TARGET("ssse3")
+void get_packed_ssse3(ValueType* values, const uint8_t* input,
+                      std::size_t elements)
+{
+    constexpr uint8_t size = sizeof(ValueType);
+    const __m128i mask = unpack_mask<Bytes, size, Order == byte_order::big>();
+    const __m128i sign =
+        _mm_set1_epi64x(static_cast<int64_t>(packed_sign_bits<Bytes, size>()));
+    const std::size_t step = 16 / size;
+    std::size_t i = 0;
+
+    // Each load reads 16 bytes, of which step * Bytes are used
+    for (; (elements - i) * Bytes >= 16; i += step)
+    {
+        __m128i block = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(input + i * Bytes));
+        block = _mm_shuffle_epi8(block, mask);
+        if (std::is_signed<ValueType>::value)
+        {
+            block = packed_extend(block, sign,
+                                  std::integral_constant<uint8_t, size>());
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values + i), block);
+    }
+    get_packed_scalar<Bytes, ValueType, Order>(values + i, input + i * Bytes,
+                                               elements - i);
+}
+
+template <uint8_t Bytes, class ValueType, byte_order Order>
+ENDIAN_TARGET("avx2")
+void get_packed_avx2(ValueType* values, const uint8_t* input,
+                     std::size_t elements)
+{
+    constexpr uint8_t size = sizeof(ValueType);
+    const __m256i mask = _mm256_broadcastsi128_si256(
+        unpack_mask<Bytes, size, Order == byte_order::big>());
+    const __m256i sign = _mm256_set1_epi64x(
+        static_cast<int64_t>(packed_sign_bits<Bytes, size>()));
+    const std::size_t step = 16 / size;
+    const std::size_t group = step * Bytes;
+    std::size_t i = 0;
+
+    // The groups of the two lanes are loaded separately, since the shuffle
+    // cannot move bytes between the lanes
+    for (; (elements - i) * Bytes >= group + 16; i += 2 * step)
+    {
+        const uint8_t* data = input + i * Bytes;
+        __m256i block = _mm256_set_m128i(
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data + group)),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(data)));
+        block = _mm256_shuffle_epi8(block, mask);
+        if (std::is_signed<ValueType>::value)
+        {
+            block = packed_extend(block, sign,
+                                  std::integral_constant<uint8_t, size>());
+        }
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + i), block);
+    }
+    get_packed_ssse3<Bytes, ValueType, Order>(values + i, input + i * Bytes,
+                                              elements - i);
+}
+
+// The 16 bit word of the packed bytes that ends up at word j of the vector,
+// when each 16 byte lane receives the next group of step * Bytes bytes
+template <uint8_t Bytes, uint8_t Size>
+ENDIAN_TARGET("avx512bw")
+inline __m512i packed_spread()
+{
+    const int group_words = 16 / Size * Bytes / 2;
+    alignas(64) uint16_t index[32];
+    for (int j = 0; j < 32; ++j)
+    {
+        index[j] = static_cast<uint16_t>(j / 8 * group_words + j % 8);
+    }
+    return _mm512_load_si512(index);
+}
+
+// The 16 bit word of the vector that ends up at word j of the packed bytes,
+// when each 16 byte lane holds a group of step * Bytes bytes at its start
+template <uint8_t Bytes, uint8_t Size>
+ENDIAN_TARGET("avx512bw")
+inline __m512i packed_gather()
+{
+    const int group_words = 16 / Size * Bytes / 2;
+    alignas(64) uint16_t index[32];
+    for (int j = 0; j < 32; ++j)
+    {
+        index[j] = j < 4 * group_words
+                       ? static_cast<uint16_t>(j / group_words * 8 +
+                                               j % group_words)
+                       : 0;
+    }
+    return _mm512_load_si512(index);
+}
+
+template <uint8_t Bytes, class ValueType, byte_order Order>
+ENDIAN_TARGET("avx512bw")
+void get_packed_avx512bw(ValueType* values, const uint8_t* input,
+                         std::size_t elements)
+{
+    constexpr uint8_t size = sizeof(ValueType);
+
+    // The zero-masking forms avoid false uninitialized warnings from the
+    // unmasked broadcasts in some versions of GCC
+    const __m512i mask = _mm512_maskz_broadcast_i32x4(
+        0xFFFF, unpack_mask<Bytes, size, Order == byte_order::big>());
+    const __m512i sign = _mm512_maskz_set1_epi64(
+        0xFF, static_cast<int64_t>(packed_sign_bits<Bytes, size>()));
+    const __m512i spread = packed_spread<Bytes, size>();
+    const std::size_t step = 16 / size;
+    const std::size_t group = step * Bytes;
+
+    // The groups are moved into their lanes by a word permutation, which
+    // works since a group is an even number of bytes. The masked load only
+    // touches the bytes of the four groups.
+    const __mmask64 load_mask = (uint64_t{1} << (4 * group)) - 1;
+    std::size_t i = 0;
+    for (; elements - i >= 4 * step; i += 4 * step)
+    {
+        __m512i block = _mm512_maskz_loadu_epi8(load_mask, input + i * Bytes);
+        block = _mm512_permutexvar_epi16(spread, block);
+        block = _mm512_shuffle_epi8(block, mask);
+        if (std::is_signed<ValueType>::value)
+        {
+            block = packed_extend(block, sign,
+                                  std::integral_constant<uint8_t, size>());
+        }
+        _mm512_storeu_si512(reinterpret_cast<void*>(values + i), block);
+    }
+    get_packed_avx2<Bytes, ValueType, Order>(values + i, input + i * Bytes,
+                                             elements - i);
+}
+
+template <uint8_t Bytes, class ValueType, byte_order Order>
+ENDIAN_TARGET("ssse3")
+void put_packed_ssse3(uint8_t* output, const ValueType* values,
+                      std::size_t elements)
+{
+    constexpr uint8_t size = sizeof(ValueType);
+    const __m128i mask = pack_mask<Bytes, size, Order == byte_order::big>();
+    const std::size_t step = 16 / size;
+    std::size_t i = 0;
+
+    // Each store writes 16 bytes, the bytes past the step * Bytes packed
+    // bytes are overwritten by the next store
+    for (; (elements - i) * Bytes >= 16; i += step)
+    {
+        __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+        block = _mm_shuffle_epi8(block, mask);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * Bytes),
+                         block);
+    }
+    put_packed_scalar<Bytes, ValueType, Order>(output + i * Bytes, values + i,
+                                               elements - i);
+}
+
+template <uint8_t Bytes, class ValueType, byte_order Order>
+ENDIAN_TARGET("avx2")
+void put_packed_avx2(uint8_t* output, const ValueType* values,
+                     std::size_t elements)
+{
+    constexpr uint8_t size = sizeof(ValueType);
+    const __m256i mask = _mm256_broadcastsi128_si256(
+        pack_mask<Bytes, size, Order == byte_order::big>());
+    const std::size_t step = 16 / size;
+    const std::size_t group = step * Bytes;
+    std::size_t i = 0;
+
+    for (; (elements - i) * Bytes >= group + 16; i += 2 * step)
+    {
+        uint8_t* data = output + i * Bytes;
+        __m256i block =
+            _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+        block = _mm256_shuffle_epi8(block, mask);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data),
+                         _mm256_castsi256_si128(block));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + group),
+                         _mm256_extracti128_si256(block, 1));
+    }
+    put_packed_ssse3<Bytes, ValueType, Order>(output + i * Bytes, values + i,
+                                              elements - i);
+}
+
+template <uint8_t Bytes, class ValueType, byte_order Order>
+ENDIAN_TARGET("avx512bw")
+void put_packed_avx512bw(uint8_t* output, const ValueType* values,
+                         std::size_t elements)
+{
+    constexpr uint8_t size = sizeof(ValueType);
+    const __m512i mask = _mm512_maskz_broadcast_i32x4(
+        0xFFFF, pack_mask<Bytes, size, Order == byte_order::big>());
+    const __m512i gather = packed_gather<Bytes, size>();
+    const std::size_t step = 16 / size;
+    const std::size_t group = step * Bytes;
+
+    // The masked store only writes the packed bytes
+    const __mmask64 store_mask = (uint64_t{1} << (4 * group)) - 1;
+    std::size_t i = 0;
+    for (; elements - i >= 4 * step; i += 4 * step)
+    {
+        __m512i block =
+            _mm512_loadu_si512(reinterpret_cast<const void*>(values + i));
+        block = _mm512_shuffle_epi8(block, mask);
+        block = _mm512_permutexvar_epi16(gather, block);
+        _mm512_mask_storeu_epi8(output + i * Bytes, store_mask, block);
+    }
+    put_packed_avx2<Bytes, ValueType, Order>(output + i * Bytes, values + i,
+                                             elements - i);
+}
+#endif
+
+// Converts arrays of Bytes-sized integers packed without padding to and from
+// arrays of ValueType, in the Order byte order. Signed values are sign
+// extended from the top bit of the packed bytes.
+//
+// The kernel for the active CPU level is looked up in a table built once,
+// like for swap_array.
+template <uint8_t Bytes, class ValueType, byte_order Order>
+struct packed_array
+{
+    static_assert(is_packed_width<Bytes, ValueType>::value,
+                  "Only 3 byte widths of 32 bit values and 5 to 7 byte "
+                  "widths of 64 bit values are supported");
+
+    using get_kernel = void (*)(ValueType*, const uint8_t*, std::size_t);
+    using put_kernel = void (*)(uint8_t*, const ValueType*, std::size_t);
+
+    static void get(ValueType* values, const uint8_t* input,
+                    std::size_t elements)
+    {
+        // Arrays shorter than a vector are not worth the indirect call
+        if (elements * Bytes < 16)
+        {
+            get_packed_scalar<Bytes, ValueType, Order>(values, input,
+                                                       elements);
+            return;
+        }
+        select_get(active_cpu_level())(values, input, elements);
+    }
+
+    static void put(uint8_t* output, const ValueType* values,
+                    std::size_t elements)
+    {
+        if (elements * Bytes < 16)
+        {
+            put_packed_scalar<Bytes, ValueType, Order>(output, values,
+                                                       elements);
+            return;
+        }
+        select_put(active_cpu_level())(output, values, elements);
+    }
+
+    // The kernels used at the given CPU level
+    static get_kernel select_get(cpu_level level)
+    {
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+        static const get_kernel kernels[] = {
+            get_packed_scalar<Bytes, ValueType, Order>,
+            get_packed_scalar<Bytes, ValueType, Order>,
+            get_packed_ssse3<Bytes, ValueType, Order>,
+            get_packed_avx2<Bytes, ValueType, Order>,
+            get_packed_avx512bw<Bytes, ValueType, Order>};
+        return kernels[static_cast<int>(level)];
+#else
+        (void)level;
+        return get_packed_scalar<Bytes, ValueType, Order>;
+#endif
+    }
+
+    static put_kernel select_put(cpu_level level)
+    {
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+        static const put_kernel kernels[] = {
+            put_packed_scalar<Bytes, ValueType, Order>,
+            put_packed_scalar<Bytes, ValueType, Order>,
+            put_packed_ssse3<Bytes, ValueType, Order>,
+            put_packed_avx2<Bytes, ValueType, Order>,
+            put_packed_avx512bw<Bytes, ValueType, Order>};
+        return kernels[static_cast<int>(level)];
+#else
+        (void)level;
+        return put_packed_scalar<Bytes, ValueType, Order>;
+#endif
+    }
+};
+}
+}
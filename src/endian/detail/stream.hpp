@@ -11,6 +11,9 @@
 #include <type_traits>
 #include <vector>
 
+#include "../assert_check.hpp"
+#include "../no_checksum.hpp"
+
 namespace endian
 {
 namespace detail
@@ -20,8 +23,14 @@ using non_const_stream = uint8_t*;
 using const_stream = const uint8_t*;
 
 /// @brief Base-class for the endian stream reader and writer.
-template <typename data_ptr_type>
-class stream
+///
+/// The CheckPolicy decides how accesses outside the buffer are handled, see
+/// unchecked, assert_check, throw_check and error_code_check. The
+/// ChecksumPolicy is given every byte the stream moves past, see no_checksum
+/// and crc32c_checksum.
+template <typename data_ptr_type, typename CheckPolicy = assert_check,
+          typename ChecksumPolicy = no_checksum>
+class stream : public CheckPolicy, public ChecksumPolicy
 {
 public:
     /// Creates an endian stream used to track a buffer of the specified size.
@@ -58,24 +67,37 @@ public:
 
     /// Changes the current read/write position in the stream. The
     /// position is absolute i.e. it is always relative to the
-    /// beginning of the buffer which is position 0.
+    /// beginning of the buffer which is position 0. The checksum is not
+    /// changed, bytes already counted in it stay counted with the values
+    /// they had when the stream moved past them, also if they are
+    /// overwritten after the seek.
     ///
     /// @param new_position the new position
-    void seek(std::size_t new_position) noexcept
+    void seek(std::size_t new_position) noexcept(CheckPolicy::is_noexcept)
     {
-        assert(new_position <= m_size);
+        if (!this->check(new_position <= m_size,
+                         "Seeking past the end of the underlying buffer"))
+        {
+            return;
+        }
 
+        this->fold_checksum();
         m_position = new_position;
     }
 
-    /// Skips over a given number of bytes in the stream
+    /// Skips over a given number of bytes in the stream. The skipped bytes
+    /// are included in the checksum.
     ///
     /// @param bytes_to_skip the bytes to skip
-    void skip(std::size_t bytes_to_skip) noexcept
+    void skip(std::size_t bytes_to_skip) noexcept(CheckPolicy::is_noexcept)
     {
-        assert(bytes_to_skip <= m_size - m_position);
+        if (!this->check(bytes_to_skip <= m_size - m_position,
+                         "Skipping past the end of the underlying buffer"))
+        {
+            return;
+        }
 
-        seek(m_position + bytes_to_skip);
+        advance(bytes_to_skip);
     }
 
     /// A pointer to the stream's data.
@@ -94,6 +116,18 @@ public:
         return m_data + m_position;
     }
 
+protected:
+    /// Moves the position forward without any checks and folds the bytes
+    /// moved past into the checksum. Used by the reader and writer once an
+    /// access has been checked.
+    ///
+    /// @param bytes the number of bytes to move
+    void advance(std::size_t bytes) noexcept
+    {
+        this->update_checksum(m_data + m_position, bytes);
+        m_position += bytes;
+    }
+
 private:
     /// Data pointer to buffer
     data_ptr_type m_data;
@@ -0,0 +1,198 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+
+#include "../cpu_features.hpp"
+#include "byte_swap.hpp"
+#include "cpuid.hpp"
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+#include <immintrin.h>
+#endif
+
+namespace endian
+{
+namespace detail
+{
+
+// Index of the byte that ends up at position j of a 16 byte lane when every
+// Bytes-sized element in the lane is reversed
+constexpr char swap_index(uint8_t bytes, int j)
+{
+    return static_cast<char>((j / bytes) * bytes + bytes - 1 - (j % bytes));
+}
+
+// Reverses the byte order of the elements one at a time
+template <uint8_t Bytes>
+inline void swap_array_scalar(uint8_t* output, const uint8_t* input,
+                              std::size_t elements)
+{
+    using UnsignedType = typename unsigned_type<Bytes>::type;
+    const uint8_t* end = input + elements * Bytes;
+    for (; input != end; input += Bytes, output += Bytes)
+    {
+        UnsignedType temp;
+        memcpy(&temp, input, Bytes);
+        temp = byte_swap(temp);
+        memcpy(output, &temp, Bytes);
+    }
+}
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+// The shuffle mask reversing each Bytes-sized element of a 16 byte lane
+template <uint8_t Bytes>
+inline __m128i swap_mask()
+{
+    return _mm_setr_epi8(
+        swap_index(Bytes, 0), swap_index(Bytes, 1), swap_index(Bytes, 2),
+        swap_index(Bytes, 3), swap_index(Bytes, 4), swap_index(Bytes, 5),
+        swap_index(Bytes, 6), swap_index(Bytes, 7), swap_index(Bytes, 8),
+        swap_index(Bytes, 9), swap_index(Bytes, 10), swap_index(Bytes, 11),
+        swap_index(Bytes, 12), swap_index(Bytes, 13), swap_index(Bytes, 14),
+        swap_index(Bytes, 15));
+}
+
+// The vector kernels swap as many whole vectors as possible, falling back to
+// the narrower kernels and finally the scalar loop for the remainder
+template <uint8_t Bytes>
+ENDIAN_TARGET("ssse3")
+void swap_array_ssse3(uint8_t* output, const uint8_t* input,
+                      std::size_t elements)
+{
+    const __m128i mask = swap_mask<Bytes>();
+    const std::size_t step = 16 / Bytes;
+    std::size_t i = 0;
+    for (; i + step <= elements; i += step)
+    {
+        __m128i block = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(input + i * Bytes));
+        block = _mm_shuffle_epi8(block, mask);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(output + i * Bytes),
+                         block);
+    }
+    swap_array_scalar<Bytes>(output + i * Bytes, input + i * Bytes,
+                             elements - i);
+}
+
+template <uint8_t Bytes>
+ENDIAN_TARGET("avx2")
+void swap_array_avx2(uint8_t* output, const uint8_t* input,
+                     std::size_t elements)
+{
+    const __m256i mask = _mm256_broadcastsi128_si256(swap_mask<Bytes>());
+    const std::size_t step = 32 / Bytes;
+    std::size_t i = 0;
+    for (; i + step <= elements; i += step)
+    {
+        __m256i block = _mm256_loadu_si256(
+            reinterpret_cast<const __m256i*>(input + i * Bytes));
+        block = _mm256_shuffle_epi8(block, mask);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(output + i * Bytes),
+                            block);
+    }
+    swap_array_ssse3<Bytes>(output + i * Bytes, input + i * Bytes,
+                            elements - i);
+}
+
+template <uint8_t Bytes>
+ENDIAN_TARGET("avx512bw")
+void swap_array_avx512bw(uint8_t* output, const uint8_t* input,
+                         std::size_t elements)
+{
+    // The zero-masking broadcast avoids a false uninitialized warning from
+    // the unmasked broadcast in some versions of GCC
+    const __m512i mask =
+        _mm512_maskz_broadcast_i32x4(0xFFFF, swap_mask<Bytes>());
+    const std::size_t step = 64 / Bytes;
+    std::size_t i = 0;
+    for (; i + step <= elements; i += step)
+    {
+        __m512i block = _mm512_loadu_si512(
+            reinterpret_cast<const void*>(input + i * Bytes));
+        block = _mm512_shuffle_epi8(block, mask);
+        _mm512_storeu_si512(reinterpret_cast<void*>(output + i * Bytes),
+                            block);
+    }
+    swap_array_avx2<Bytes>(output + i * Bytes, input + i * Bytes,
+                           elements - i);
+}
+#endif
+
+// Reverses the byte order of a number of Bytes-sized elements. The input and
+// output buffers may be the same buffer, but must otherwise not overlap.
+//
+// The kernel for the active CPU level is looked up in a table built once, so
+// a binary built for the baseline target still uses the widest vector unit
+// of the CPU it runs on.
+template <uint8_t Bytes>
+struct swap_array
+{
+#if defined(ENDIAN_INT128)
+    // A 128 bit element fills a whole lane, so it is a single shuffle
+    static_assert(Bytes == 2 || Bytes == 4 || Bytes == 8 || Bytes == 16,
+                  "Only 16, 32, 64 and 128 bit elements are supported");
+#else
+    static_assert(Bytes == 2 || Bytes == 4 || Bytes == 8,
+                  "Only 16, 32 and 64 bit elements are supported");
+#endif
+
+    using kernel = void (*)(uint8_t*, const uint8_t*, std::size_t);
+
+    static void apply(uint8_t* output, const uint8_t* input,
+                      std::size_t elements)
+    {
+        // Arrays shorter than a vector are not worth the indirect call
+        if (elements * Bytes < 16)
+        {
+            swap_array_scalar<Bytes>(output, input, elements);
+            return;
+        }
+        select(active_cpu_level())(output, input, elements);
+    }
+
+    // The kernel used at the given CPU level
+    static kernel select(cpu_level level)
+    {
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+        static const kernel kernels[] = {
+            swap_array_scalar<Bytes>, swap_array_scalar<Bytes>,
+            swap_array_ssse3<Bytes>, swap_array_avx2<Bytes>,
+            swap_array_avx512bw<Bytes>};
+        return kernels[static_cast<int>(level)];
+#else
+        (void)level;
+        return swap_array_scalar<Bytes>;
+#endif
+    }
+};
+
+// Copies a number of bytes without changing the byte order. The input and
+// output buffers may be the same buffer, but must otherwise not overlap.
+inline void copy_array(uint8_t* output, const uint8_t* input,
+                       std::size_t bytes)
+{
+    if (output != input && bytes != 0)
+    {
+        memcpy(output, input, bytes);
+    }
+}
+
+// Single byte elements have no byte order
+template <>
+struct swap_array<1>
+{
+    static void apply(uint8_t* output, const uint8_t* input,
+                      std::size_t elements)
+    {
+        copy_array(output, input, elements);
+    }
+};
+
+}
+}
@@ -0,0 +1,47 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+
+namespace endian
+{
+namespace detail
+{
+// Converts a list of values at consecutive offsets from a fixed base pointer.
+// The offsets are known at compile time so each value becomes a single access
+// relative to the same pointer.
+template <class EndianType>
+struct variadic
+{
+    static void put(uint8_t* buffer)
+    {
+        (void)buffer;
+    }
+
+    template <class ValueType, class... ValueTypes>
+    static void put(uint8_t* buffer, const ValueType& value,
+                    const ValueTypes&... values)
+    {
+        EndianType::put(value, buffer);
+        put(buffer + sizeof(ValueType), values...);
+    }
+
+    static void get(const uint8_t* buffer)
+    {
+        (void)buffer;
+    }
+
+    template <class ValueType, class... ValueTypes>
+    static void get(const uint8_t* buffer, ValueType& value,
+                    ValueTypes&... values)
+    {
+        EndianType::get(value, buffer);
+        get(buffer + sizeof(ValueType), values...);
+    }
+};
+}
+}
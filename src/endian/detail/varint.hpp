@@ -0,0 +1,201 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+#include "bit_scan.hpp"
+#include "byte_swap.hpp"
+
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace endian
+{
+namespace detail
+{
+// The largest encoding of a 64 bit value
+constexpr std::size_t max_varint_size = 10;
+
+// The outcome of decoding a varint
+enum class varint_error
+{
+    none,
+    truncated,
+    overlong
+};
+
+// Maps signed values to unsigned values so that values of small magnitude get
+// short encodings, as done for the protobuf sint32 and sint64 types
+inline uint64_t zigzag_encode(int64_t value)
+{
+    return (static_cast<uint64_t>(value) << 1) ^
+           static_cast<uint64_t>(value >> 63);
+}
+
+inline int64_t zigzag_decode(uint64_t value)
+{
+    return static_cast<int64_t>((value >> 1) ^ (~(value & 1) + 1));
+}
+
+// Converts between the values of the stream API and the encoded 64 bit
+// values. Unsigned values are encoded as they are and signed values are
+// zigzag encoded. Integers wider than 64 bits, like __int128 in GNU mode,
+// would be truncated and are rejected.
+template <class ValueType, bool IsSigned = std::is_signed<ValueType>::value>
+struct varint_value
+{
+    static_assert(std::is_integral<ValueType>::value &&
+                      !std::is_same<ValueType, bool>::value,
+                  "Only integer types are supported");
+    static_assert(sizeof(ValueType) <= 8,
+                  "Only integers of at most 64 bits are supported");
+
+    static uint64_t encode(ValueType value)
+    {
+        return value;
+    }
+
+    // A decoded value must fit in the ValueType
+    static bool fits(uint64_t value)
+    {
+        return value <= std::numeric_limits<ValueType>::max();
+    }
+
+    static ValueType decode(uint64_t value)
+    {
+        return static_cast<ValueType>(value);
+    }
+};
+
+template <class ValueType>
+struct varint_value<ValueType, true>
+{
+    static_assert(sizeof(ValueType) <= 8,
+                  "Only integers of at most 64 bits are supported");
+
+    using UnsignedType = typename std::make_unsigned<ValueType>::type;
+
+    static uint64_t encode(ValueType value)
+    {
+        return zigzag_encode(value);
+    }
+
+    // The zigzag encoding of a ValueType fits in the unsigned type of the
+    // same size
+    static bool fits(uint64_t value)
+    {
+        return value <= std::numeric_limits<UnsignedType>::max();
+    }
+
+    static ValueType decode(uint64_t value)
+    {
+        return static_cast<ValueType>(zigzag_decode(value));
+    }
+};
+
+// The number of bytes needed to encode a value
+inline std::size_t varint_size(uint64_t value)
+{
+    const uint32_t bits = 64 - count_leading_zeros(value | 1);
+    return (bits + 6) / 7;
+}
+
+// Encodes a value as a varint and returns the number of bytes written, which
+// is at most max_varint_size
+inline std::size_t encode_varint(uint64_t value, uint8_t* data)
+{
+    // Most values in practice are small and take a single store
+    if (value < 0x80)
+    {
+        data[0] = static_cast<uint8_t>(value);
+        return 1;
+    }
+
+    std::size_t length = 0;
+    while (value >= 0x80)
+    {
+        data[length++] = static_cast<uint8_t>(value | 0x80);
+        value >>= 7;
+    }
+    data[length++] = static_cast<uint8_t>(value);
+    return length;
+}
+
+// Packs the low 7 bits of each byte of a word into a 56 bit value
+inline uint64_t compact_varint(uint64_t word)
+{
+#if defined(__BMI2__)
+    return _pext_u64(word, 0x7F7F7F7F7F7F7F7FULL);
+#else
+    word &= 0x7F7F7F7F7F7F7F7FULL;
+    word = ((word & 0x7F007F007F007F00ULL) >> 1) |
+           (word & 0x007F007F007F007FULL);
+    word = ((word & 0x3FFF00003FFF0000ULL) >> 2) |
+           (word & 0x00003FFF00003FFFULL);
+    word = ((word & 0x0FFFFFFF00000000ULL) >> 4) |
+           (word & 0x000000000FFFFFFFULL);
+    return word;
+#endif
+}
+
+// Decodes a varint from at most size bytes. On success length is the number
+// of bytes used. Redundant continuation bytes are accepted as long as the
+// varint fits in max_varint_size bytes, like protobuf does. On failure length
+// is the number of bytes inspected, which never exceeds size.
+inline varint_error decode_varint(const uint8_t* data, std::size_t size,
+                                  uint64_t& value, std::size_t& length)
+{
+    // With 8 bytes available every varint of up to 56 bits is decoded from
+    // a single load without branching on each byte
+    if (size >= 8)
+    {
+        uint64_t word;
+        full_width<uint64_t, byte_order::little>::get(word, data);
+
+        const uint64_t stops = ~word & 0x8080808080808080ULL;
+        if (stops != 0)
+        {
+            // Keep the bytes up to and including the first stop bit
+            const uint64_t mask = stops ^ (stops - 1);
+            length = count_trailing_zeros(stops) / 8 + 1;
+            value = compact_varint(word & mask);
+            return varint_error::none;
+        }
+    }
+
+    value = 0;
+    for (std::size_t i = 0; i < max_varint_size; ++i)
+    {
+        if (i == size)
+        {
+            length = i;
+            return varint_error::truncated;
+        }
+
+        const uint64_t byte = data[i];
+        value |= (byte & 0x7F) << (7 * i);
+        if ((byte & 0x80) == 0)
+        {
+            length = i + 1;
+
+            // The last byte of a 64 bit value can only hold a single bit
+            if (i == max_varint_size - 1 && byte > 1)
+            {
+                return varint_error::overlong;
+            }
+            return varint_error::none;
+        }
+    }
+
+    length = max_varint_size;
+    return varint_error::overlong;
+}
+}
+}
@@ -0,0 +1,196 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+
+namespace endian
+{
+namespace detail
+{
+// Proxy reference to a Bytes-sized value stored in the byte order of
+// EndianType. Assigning to it stores a new value.
+template <class EndianType, uint8_t Bytes, class ValueType>
+class view_reference
+{
+public:
+    explicit view_reference(uint8_t* data) noexcept : m_data(data)
+    {
+    }
+
+    view_reference(const view_reference&) = default;
+
+    operator ValueType() const noexcept
+    {
+        return EndianType::template get_bytes<Bytes, ValueType>(m_data);
+    }
+
+    const view_reference& operator=(ValueType value) const noexcept
+    {
+        EndianType::template put_bytes<Bytes>(value, m_data);
+        return *this;
+    }
+
+    const view_reference& operator=(const view_reference& other) const noexcept
+    {
+        return *this = static_cast<ValueType>(other);
+    }
+
+private:
+    uint8_t* m_data;
+};
+
+// Loads the values of a const view and references the values of a mutable
+// view
+template <class EndianType, uint8_t Bytes, class ValueType, class DataPointer>
+struct view_access
+{
+    using reference = ValueType;
+
+    static reference get(const uint8_t* data) noexcept
+    {
+        return EndianType::template get_bytes<Bytes, ValueType>(data);
+    }
+};
+
+template <class EndianType, uint8_t Bytes, class ValueType>
+struct view_access<EndianType, Bytes, ValueType, uint8_t*>
+{
+    using reference = view_reference<EndianType, Bytes, ValueType>;
+
+    static reference get(uint8_t* data) noexcept
+    {
+        return reference(data);
+    }
+};
+
+// Random access iterator over Bytes-sized values stored back to back
+template <class EndianType, uint8_t Bytes, class ValueType, class DataPointer>
+class view_iterator
+{
+    using access = view_access<EndianType, Bytes, ValueType, DataPointer>;
+
+public:
+    using iterator_category = std::random_access_iterator_tag;
+    using value_type = ValueType;
+    using difference_type = std::ptrdiff_t;
+    using pointer = void;
+    using reference = typename access::reference;
+
+    view_iterator() noexcept : m_data(nullptr)
+    {
+    }
+
+    explicit view_iterator(DataPointer data) noexcept : m_data(data)
+    {
+    }
+
+    reference operator*() const noexcept
+    {
+        return access::get(m_data);
+    }
+
+    reference operator[](difference_type n) const noexcept
+    {
+        return access::get(m_data + n * Bytes);
+    }
+
+    view_iterator& operator++() noexcept
+    {
+        m_data += Bytes;
+        return *this;
+    }
+
+    view_iterator operator++(int) noexcept
+    {
+        view_iterator old = *this;
+        m_data += Bytes;
+        return old;
+    }
+
+    view_iterator& operator--() noexcept
+    {
+        m_data -= Bytes;
+        return *this;
+    }
+
+    view_iterator operator--(int) noexcept
+    {
+        view_iterator old = *this;
+        m_data -= Bytes;
+        return old;
+    }
+
+    view_iterator& operator+=(difference_type n) noexcept
+    {
+        m_data += n * Bytes;
+        return *this;
+    }
+
+    view_iterator& operator-=(difference_type n) noexcept
+    {
+        m_data -= n * Bytes;
+        return *this;
+    }
+
+    view_iterator operator+(difference_type n) const noexcept
+    {
+        return view_iterator(m_data + n * Bytes);
+    }
+
+    friend view_iterator operator+(difference_type n,
+                                   const view_iterator& it) noexcept
+    {
+        return it + n;
+    }
+
+    view_iterator operator-(difference_type n) const noexcept
+    {
+        return view_iterator(m_data - n * Bytes);
+    }
+
+    difference_type operator-(const view_iterator& other) const noexcept
+    {
+        return (m_data - other.m_data) / Bytes;
+    }
+
+    bool operator==(const view_iterator& other) const noexcept
+    {
+        return m_data == other.m_data;
+    }
+
+    bool operator!=(const view_iterator& other) const noexcept
+    {
+        return m_data != other.m_data;
+    }
+
+    bool operator<(const view_iterator& other) const noexcept
+    {
+        return m_data < other.m_data;
+    }
+
+    bool operator>(const view_iterator& other) const noexcept
+    {
+        return m_data > other.m_data;
+    }
+
+    bool operator<=(const view_iterator& other) const noexcept
+    {
+        return m_data <= other.m_data;
+    }
+
+    bool operator>=(const view_iterator& other) const noexcept
+    {
+        return m_data >= other.m_data;
+    }
+
+private:
+    DataPointer m_data;
+};
+}
+}
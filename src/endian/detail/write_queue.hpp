@@ -0,0 +1,505 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <algorithm>
+#include <cerrno>
+#include <condition_variable>
+#include <cstdint>
+#include <cstring>
+#include <deque>
+#include <mutex>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#include <fcntl.h>
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#if defined(__NR_io_uring_setup) && defined(__NR_io_uring_enter)
+#define ENDIAN_IO_URING 1
+#endif
+#endif
+#endif
+
+namespace endian
+{
+namespace detail
+{
+// A block of data written to a file descriptor, at a given offset if the
+// file descriptor is seekable
+struct write_block
+{
+    uint8_t* data = nullptr;
+    std::size_t size = 0;
+    uint64_t offset = 0;
+
+    // The part of the block which has been written
+    std::size_t written = 0;
+
+    // Set if the block could not be written
+    std::error_code error;
+
+    // The iovec submitted to the kernel, which must stay valid while the
+    // write is in flight
+    iovec vector;
+};
+
+// Writes blocks in the background. Blocks are submitted without waiting for
+// the write, and are handed back through the completion functions once they
+// have been written or have failed.
+class write_queue
+{
+public:
+    virtual ~write_queue() = default;
+
+    // Starts writing a block
+    virtual void submit(write_block* block) = 0;
+
+    // Returns a written block, or nullptr if none has completed yet
+    virtual write_block* poll_completion() = 0;
+
+    // Waits for a written block, or returns nullptr if no block is in flight
+    virtual write_block* wait_completion() = 0;
+};
+
+// Writes a block with pwrite, or write for file descriptors which are not
+// seekable, retrying until the whole block is written
+inline void write_fully(int fd, bool seekable, write_block* block)
+{
+    while (block->written < block->size)
+    {
+        const uint8_t* data = block->data + block->written;
+        const std::size_t size = block->size - block->written;
+        const ssize_t result =
+            seekable ? pwrite(fd, data, size,
+                              static_cast<off_t>(block->offset + block->written))
+                     : write(fd, data, size);
+        if (result < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            block->error = std::error_code(errno, std::generic_category());
+            return;
+        }
+        if (result == 0)
+        {
+            block->error = std::make_error_code(std::errc::io_error);
+            return;
+        }
+        block->written += static_cast<std::size_t>(result);
+    }
+}
+
+// Writes the blocks in order on a background thread
+class thread_write_queue : public write_queue
+{
+public:
+    thread_write_queue(int fd, bool seekable) :
+        m_fd(fd), m_seekable(seekable), m_thread([this]() { run(); })
+    {
+    }
+
+    ~thread_write_queue() override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stop = true;
+        }
+        m_changed.notify_all();
+        m_thread.join();
+    }
+
+    void submit(write_block* block) override
+    {
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_pending.push_back(block);
+            ++m_in_flight;
+        }
+        m_changed.notify_all();
+    }
+
+    write_block* poll_completion() override
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return take_completed();
+    }
+
+    write_block* wait_completion() override
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_changed.wait(lock, [this]() {
+            return !m_completed.empty() || m_in_flight == 0;
+        });
+        return take_completed();
+    }
+
+private:
+    write_block* take_completed()
+    {
+        if (m_completed.empty())
+        {
+            return nullptr;
+        }
+        write_block* block = m_completed.front();
+        m_completed.pop_front();
+        return block;
+    }
+
+    void run()
+    {
+        while (true)
+        {
+            write_block* block = nullptr;
+            {
+                std::unique_lock<std::mutex> lock(m_mutex);
+                m_changed.wait(lock,
+                               [this]() { return m_stop || !m_pending.empty(); });
+                if (m_pending.empty())
+                {
+                    return;
+                }
+                block = m_pending.front();
+                m_pending.pop_front();
+            }
+
+            write_fully(m_fd, m_seekable, block);
+
+            {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                m_completed.push_back(block);
+                --m_in_flight;
+            }
+            m_changed.notify_all();
+        }
+    }
+
+private:
+    int m_fd;
+    bool m_seekable;
+
+    std::mutex m_mutex;
+    std::condition_variable m_changed;
+    std::deque<write_block*> m_pending;
+    std::deque<write_block*> m_completed;
+    std::size_t m_in_flight = 0;
+    bool m_stop = false;
+
+    std::thread m_thread;
+};
+
+#if defined(ENDIAN_IO_URING)
+// Writes the blocks through an io_uring, so any number of blocks can be in
+// flight without a thread. The ring is set up with the raw system calls, so
+// liburing is not needed. Only used for seekable file descriptors, as the
+// writes may complete in any order.
+class uring_write_queue : public write_queue
+{
+public:
+    // Sets up a ring with room for the given number of writes, setting the
+    // error if io_uring is not available
+    uring_write_queue(int fd, unsigned entries, std::error_code& error) :
+        m_fd(fd)
+    {
+        io_uring_params params;
+        memset(&params, 0, sizeof(params));
+        const long ring =
+            syscall(__NR_io_uring_setup, entries, &params);
+        if (ring < 0)
+        {
+            error = std::error_code(errno, std::generic_category());
+            return;
+        }
+        m_ring = static_cast<int>(ring);
+
+        // Buffered writes are otherwise copied to the page cache during the
+        // submission, i.e. on the writing thread, while direct writes are
+        // asynchronous in any case. IOSQE_ASYNC came with Linux 5.6 and
+        // earlier kernels fail every write carrying it, so it is only set
+        // when the ring has a feature of a later kernel.
+#if defined(IORING_FEAT_FAST_POLL)
+        const int status = fcntl(fd, F_GETFL);
+        if ((params.features & IORING_FEAT_FAST_POLL) != 0 &&
+            (status < 0 || (status & O_DIRECT) == 0))
+        {
+            m_flags = IOSQE_ASYNC;
+        }
+#endif
+
+        m_sq_size = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+        m_cq_size =
+            params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+        m_sqes_size = params.sq_entries * sizeof(io_uring_sqe);
+
+        m_sq = map(m_sq_size, IORING_OFF_SQ_RING, error);
+        m_cq = map(m_cq_size, IORING_OFF_CQ_RING, error);
+        m_sqes = map(m_sqes_size, IORING_OFF_SQES, error);
+        if (error)
+        {
+            return;
+        }
+
+        m_sq_head = ring_field(m_sq, params.sq_off.head);
+        m_sq_tail = ring_field(m_sq, params.sq_off.tail);
+        m_sq_entries = params.sq_entries;
+        m_sq_mask = *ring_field(m_sq, params.sq_off.ring_mask);
+        m_sq_array = ring_field(m_sq, params.sq_off.array);
+        m_cq_head = ring_field(m_cq, params.cq_off.head);
+        m_cq_tail = ring_field(m_cq, params.cq_off.tail);
+        m_cq_mask = *ring_field(m_cq, params.cq_off.ring_mask);
+        m_cqes = reinterpret_cast<io_uring_cqe*>(
+            static_cast<uint8_t*>(m_cq) + params.cq_off.cqes);
+    }
+
+    ~uring_write_queue() override
+    {
+        // The kernel may still be reading from the blocks
+        while (wait_completion() != nullptr)
+        {
+        }
+        unmap(m_sqes, m_sqes_size);
+        unmap(m_cq, m_cq_size);
+        unmap(m_sq, m_sq_size);
+        if (m_ring >= 0)
+        {
+            close(m_ring);
+        }
+    }
+
+    void submit(write_block* block) override
+    {
+        ++m_in_flight;
+        if (!enqueue(block))
+        {
+            block->error = std::error_code(errno, std::generic_category());
+            m_failed.push_back(block);
+        }
+    }
+
+    write_block* poll_completion() override
+    {
+        return complete(false);
+    }
+
+    write_block* wait_completion() override
+    {
+        return complete(true);
+    }
+
+private:
+    static unsigned* ring_field(void* ring, uint32_t offset)
+    {
+        return reinterpret_cast<unsigned*>(static_cast<uint8_t*>(ring) +
+                                           offset);
+    }
+
+    void* map(std::size_t size, off_t offset, std::error_code& error)
+    {
+        if (error)
+        {
+            return nullptr;
+        }
+        void* ring = mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                          MAP_SHARED | MAP_POPULATE, m_ring, offset);
+        if (ring == MAP_FAILED)
+        {
+            error = std::error_code(errno, std::generic_category());
+            return nullptr;
+        }
+        return ring;
+    }
+
+    static void unmap(void* ring, std::size_t size)
+    {
+        if (ring != nullptr)
+        {
+            munmap(ring, size);
+        }
+    }
+
+    // Places a write of the unwritten part of the block in the submission
+    // queue and hands it to the kernel. Returns false with errno set if the
+    // kernel did not take the write, which then is not left in the queue.
+    bool enqueue(write_block* block)
+    {
+        if (m_ring_error != 0)
+        {
+            errno = m_ring_error;
+            return false;
+        }
+
+        const unsigned tail = *m_sq_tail;
+        if (tail - __atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE) >= m_sq_entries)
+        {
+            errno = EBUSY;
+            return false;
+        }
+
+        block->vector.iov_base = block->data + block->written;
+        block->vector.iov_len = block->size - block->written;
+
+        const unsigned index = tail & m_sq_mask;
+        io_uring_sqe* sqe = static_cast<io_uring_sqe*>(m_sqes) + index;
+        memset(sqe, 0, sizeof(*sqe));
+        sqe->opcode = IORING_OP_WRITEV;
+        sqe->flags = m_flags;
+        sqe->fd = m_fd;
+        sqe->addr = reinterpret_cast<uint64_t>(&block->vector);
+        sqe->len = 1;
+        sqe->off = block->offset + block->written;
+        sqe->user_data = reinterpret_cast<uint64_t>(block);
+        m_sq_array[index] = index;
+        __atomic_store_n(m_sq_tail, tail + 1, __ATOMIC_RELEASE);
+
+        long result;
+        do
+        {
+            result = syscall(__NR_io_uring_enter, m_ring, 1, 0, 0, nullptr, 0);
+        } while (result < 0 && errno == EINTR);
+        const int error = result < 0 ? errno : EBUSY;
+
+        // The kernel moves the head past the entries it has taken, also when
+        // the call fails part way. An entry it did not take is taken back,
+        // as it would otherwise be submitted with the next write.
+        if (__atomic_load_n(m_sq_head, __ATOMIC_ACQUIRE) == tail)
+        {
+            __atomic_store_n(m_sq_tail, tail, __ATOMIC_RELEASE);
+            errno = error;
+            return false;
+        }
+        m_submitted.push_back(block);
+        return true;
+    }
+
+    // Fails all writes handed to the kernel once the ring cannot be waited
+    // on. Later writes fail with the same error, so the caller sees the
+    // error rather than waiting forever. The kernel only reads from the
+    // blocks, so a write still running when a block is reused can at worst
+    // write wrong data to a stream which has already failed.
+    void fail_submitted(int error)
+    {
+        m_ring_error = error;
+        for (write_block* block : m_submitted)
+        {
+            block->error = std::error_code(error, std::generic_category());
+            m_failed.push_back(block);
+        }
+        m_submitted.clear();
+    }
+
+    // Reaps completed writes, resubmitting the rest of short writes, until a
+    // block has been written or failed
+    write_block* complete(bool wait)
+    {
+        while (true)
+        {
+            if (!m_failed.empty())
+            {
+                write_block* block = m_failed.front();
+                m_failed.pop_front();
+                --m_in_flight;
+                return block;
+            }
+            if (m_in_flight == 0)
+            {
+                return nullptr;
+            }
+
+            const unsigned head = *m_cq_head;
+            if (head == __atomic_load_n(m_cq_tail, __ATOMIC_ACQUIRE))
+            {
+                if (!wait)
+                {
+                    return nullptr;
+                }
+                if (syscall(__NR_io_uring_enter, m_ring, 0, 1,
+                            IORING_ENTER_GETEVENTS, nullptr, 0) < 0 &&
+                    errno != EINTR)
+                {
+                    fail_submitted(errno);
+                }
+                continue;
+            }
+
+            const io_uring_cqe& cqe = m_cqes[head & m_cq_mask];
+            write_block* block = reinterpret_cast<write_block*>(cqe.user_data);
+            const int32_t result = cqe.res;
+            __atomic_store_n(m_cq_head, head + 1, __ATOMIC_RELEASE);
+            m_submitted.erase(
+                std::find(m_submitted.begin(), m_submitted.end(), block));
+
+            if (result < 0)
+            {
+                block->error = std::error_code(-result, std::generic_category());
+            }
+            else if (result == 0)
+            {
+                block->error = std::make_error_code(std::errc::io_error);
+            }
+            else
+            {
+                block->written += static_cast<std::size_t>(result);
+                if (block->written < block->size)
+                {
+                    if (!enqueue(block))
+                    {
+                        block->error =
+                            std::error_code(errno, std::generic_category());
+                        m_failed.push_back(block);
+                    }
+                    continue;
+                }
+            }
+            --m_in_flight;
+            return block;
+        }
+    }
+
+private:
+    int m_fd;
+    int m_ring = -1;
+    uint8_t m_flags = 0;
+
+    void* m_sq = nullptr;
+    void* m_cq = nullptr;
+    void* m_sqes = nullptr;
+    std::size_t m_sq_size = 0;
+    std::size_t m_cq_size = 0;
+    std::size_t m_sqes_size = 0;
+
+    unsigned* m_sq_head = nullptr;
+    unsigned* m_sq_tail = nullptr;
+    unsigned* m_sq_array = nullptr;
+    unsigned m_sq_mask = 0;
+    unsigned m_sq_entries = 0;
+    unsigned* m_cq_head = nullptr;
+    unsigned* m_cq_tail = nullptr;
+    unsigned m_cq_mask = 0;
+    io_uring_cqe* m_cqes = nullptr;
+
+    std::size_t m_in_flight = 0;
+    std::deque<write_block*> m_failed;
+
+    // The writes taken by the kernel and not yet completed
+    std::vector<write_block*> m_submitted;
+
+    // Set once waiting on the ring has failed
+    int m_ring_error = 0;
+};
+#endif
+}
+}
+#endif
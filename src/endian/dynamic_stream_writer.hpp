@@ -0,0 +1,331 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+#include "detail/variadic.hpp"
+#include "detail/varint.hpp"
+#include "serialized_size.hpp"
+#include "stream_vbyte.hpp"
+
+namespace endian
+{
+/// The dynamic_stream_writer provides the same interface as the
+/// stream_writer, but writes to storage which grows as needed. The storage is
+/// obtained from the Allocator and grows geometrically, so appending is
+/// amortized constant time.
+///
+/// The writer can start out on a caller provided buffer, e.g. on the stack,
+/// and only allocates once that is full. Combined with reset() or an
+/// arena_allocator this allows building many messages without allocating
+/// for each of them.
+template <typename EndianType, typename Allocator = std::allocator<uint8_t>>
+class dynamic_stream_writer
+{
+    using allocator_traits = std::allocator_traits<Allocator>;
+
+    static_assert(std::is_same<typename allocator_traits::value_type,
+                               uint8_t>::value,
+                  "The allocator must allocate uint8_t");
+
+public:
+    /// Creates a writer without any storage.
+    ///
+    /// @param allocator the allocator used for the storage
+    explicit dynamic_stream_writer(const Allocator& allocator = Allocator()) :
+        m_allocator(allocator)
+    {
+    }
+
+    /// Creates a writer which starts out writing to a caller provided buffer.
+    /// The buffer is never deallocated by the writer and must outlive it, or
+    /// at least the first time it has to grow.
+    ///
+    /// @param data a data pointer to the initial buffer
+    /// @param capacity the size of the initial buffer in bytes
+    /// @param allocator the allocator used once the buffer is full
+    dynamic_stream_writer(uint8_t* data, std::size_t capacity,
+                          const Allocator& allocator = Allocator()) :
+        m_allocator(allocator), m_data(data), m_capacity(capacity)
+    {
+        assert((data != nullptr || capacity == 0) && "Nullpointer provided");
+    }
+
+    dynamic_stream_writer(const dynamic_stream_writer&) = delete;
+    dynamic_stream_writer& operator=(const dynamic_stream_writer&) = delete;
+
+    /// Moves the storage of another writer into a new writer
+    dynamic_stream_writer(dynamic_stream_writer&& other) noexcept :
+        m_allocator(std::move(other.m_allocator)), m_data(other.m_data),
+        m_capacity(other.m_capacity), m_size(other.m_size),
+        m_owned(other.m_owned)
+    {
+        other.m_data = nullptr;
+        other.m_capacity = 0;
+        other.m_size = 0;
+        other.m_owned = false;
+    }
+
+    ~dynamic_stream_writer()
+    {
+        deallocate();
+    }
+
+    /// Writes a Bytes-sized integer to the stream.
+    ///
+    /// @param value the value to write.
+    template <uint8_t Bytes, class ValueType>
+    void write_bytes(ValueType value)
+    {
+        EndianType::template put_bytes<Bytes>(value, extend(Bytes));
+    }
+
+    /// Writes a Bytes-sized integer to the stream.
+    ///
+    /// @param value the value to write.
+    template <class ValueType>
+    void write(ValueType value)
+    {
+        write_bytes<sizeof(ValueType), const ValueType>(value);
+    }
+
+    /// Writes a number of values to the stream in the order given, growing
+    /// the storage at most once.
+    ///
+    /// @param values the values to write
+    template <class... ValueTypes>
+    void write_all(const ValueTypes&... values)
+    {
+        const std::size_t size = serialized_size<ValueTypes...>::value;
+        detail::variadic<EndianType>::put(extend(size), values...);
+    }
+
+    /// Writes raw bytes to the stream without any endian conversion. The
+    /// bytes may be part of the stream itself.
+    ///
+    /// @param data Pointer to the data, to be written to the stream.
+    /// @param size Number of bytes from the data pointer.
+    void write(const uint8_t* data, std::size_t size)
+    {
+        if (size == 0)
+        {
+            return;
+        }
+        uint8_t* position = extend(size, data);
+        std::copy_n(data, size, position);
+    }
+
+    /// Writes an array of ValueType-sized values to the stream.
+    ///
+    /// @param values pointer to the values to write
+    /// @param elements the number of values to write
+    template <class ValueType>
+    void write_array(const ValueType* values, std::size_t elements)
+    {
+        if (elements == 0)
+        {
+            return;
+        }
+        const uint8_t* source = reinterpret_cast<const uint8_t*>(values);
+        uint8_t* position = extend(elements * sizeof(ValueType), source);
+        EndianType::put_array(reinterpret_cast<const ValueType*>(source),
+                              elements, position);
+    }
+
+    /// Writes a variable-length integer (LEB128) to the stream, see
+    /// stream_writer::write_varint().
+    ///
+    /// @param value the value to write.
+    template <class ValueType>
+    void write_varint(ValueType value)
+    {
+        const uint64_t encoded = detail::varint_value<ValueType>::encode(value);
+        detail::encode_varint(encoded, extend(detail::varint_size(encoded)));
+    }
+
+    /// Writes an array of 32 bit values to the stream with the stream_vbyte
+    /// encoding, see stream_writer::write_vbyte_array().
+    ///
+    /// @param values pointer to the values to write
+    /// @param elements the number of values to write
+    void write_vbyte_array(const uint32_t* values, std::size_t elements)
+    {
+        const std::size_t size = stream_vbyte::encoded_size(values, elements);
+        if (size == 0)
+        {
+            return;
+        }
+        stream_vbyte::encode(values, elements, extend(size));
+    }
+
+    /// Operator for writing given value to the end of the stream.
+    ///
+    /// @param value the value to write.
+    template <typename ValueType>
+    dynamic_stream_writer& operator<<(ValueType value)
+    {
+        write(value);
+        return *this;
+    }
+
+    /// Makes sure the storage can hold at least capacity bytes without
+    /// growing.
+    ///
+    /// @param capacity the number of bytes to reserve
+    void reserve(std::size_t capacity)
+    {
+        if (capacity > m_capacity)
+        {
+            reallocate(capacity);
+        }
+    }
+
+    /// Empties the stream while keeping the storage, so the next message can
+    /// be written without allocating.
+    void reset() noexcept
+    {
+        m_size = 0;
+    }
+
+    /// Hands the storage over to the caller and leaves the writer without
+    /// any storage. Unless the storage is the initial buffer provided by the
+    /// caller, it must be deallocated by the caller with get_allocator(),
+    /// using the capacity() from before the release. Nothing needs to be
+    /// done when the allocator is an arena_allocator.
+    ///
+    /// @return pointer to the written data
+    uint8_t* release() noexcept
+    {
+        uint8_t* data = m_data;
+        m_data = nullptr;
+        m_capacity = 0;
+        m_size = 0;
+        m_owned = false;
+        return data;
+    }
+
+    /// @return pointer to the written data
+    uint8_t* data() const noexcept
+    {
+        return m_data;
+    }
+
+    /// @return the number of bytes written
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @return the current write position, which is always the end of the
+    ///         written data
+    std::size_t position() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @return the number of bytes the storage can hold without growing
+    std::size_t capacity() const noexcept
+    {
+        return m_capacity;
+    }
+
+    /// @return the allocator used for the storage
+    Allocator get_allocator() const
+    {
+        return m_allocator;
+    }
+
+private:
+    /// Grows the stream by a number of bytes.
+    ///
+    /// @param bytes the number of bytes to add
+    /// @return pointer to where the bytes should be written
+    uint8_t* extend(std::size_t bytes)
+    {
+        if (bytes > m_capacity - m_size)
+        {
+            grow(bytes);
+        }
+        uint8_t* position = m_data + m_size;
+        m_size += bytes;
+        return position;
+    }
+
+    /// Grows the stream by a number of bytes copied from source, which may
+    /// point into the written bytes. Those move with the storage when it
+    /// grows, so source is moved along with them.
+    ///
+    /// @param bytes the number of bytes to add
+    /// @param source pointer to the bytes to copy
+    /// @return pointer to where the bytes should be written
+    uint8_t* extend(std::size_t bytes, const uint8_t*& source)
+    {
+        const std::less<const uint8_t*> less;
+        if (less(source, m_data) || !less(source, m_data + m_size))
+        {
+            return extend(bytes);
+        }
+        const std::size_t offset = static_cast<std::size_t>(source - m_data);
+        uint8_t* position = extend(bytes);
+        source = m_data + offset;
+        return position;
+    }
+
+    /// Grows the storage geometrically to make room for a number of bytes.
+    ///
+    /// @param bytes the number of bytes which must fit
+    void grow(std::size_t bytes)
+    {
+        const std::size_t minimum_capacity = 64;
+        reallocate(std::max({m_size + bytes, m_capacity * 2, minimum_capacity}));
+    }
+
+    void reallocate(std::size_t capacity)
+    {
+        uint8_t* data = allocator_traits::allocate(m_allocator, capacity);
+        if (m_size != 0)
+        {
+            memcpy(data, m_data, m_size);
+        }
+        deallocate();
+        m_data = data;
+        m_capacity = capacity;
+        m_owned = true;
+    }
+
+    void deallocate() noexcept
+    {
+        if (m_owned)
+        {
+            allocator_traits::deallocate(m_allocator, m_data, m_capacity);
+        }
+    }
+
+private:
+    /// The allocator used for the storage
+    Allocator m_allocator;
+
+    /// Data pointer to the storage
+    uint8_t* m_data = nullptr;
+
+    /// The size of the storage in bytes
+    std::size_t m_capacity = 0;
+
+    /// The number of bytes written
+    std::size_t m_size = 0;
+
+    /// True if the storage was allocated by the writer
+    bool m_owned = false;
+};
+}
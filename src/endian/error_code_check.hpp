@@ -0,0 +1,76 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <system_error>
+
+namespace endian
+{
+/// Check policy for the stream_reader and stream_writer which records an
+/// error instead of performing an access outside the underlying buffer, or
+/// reading malformed data. Accesses outside the buffer are recorded as
+/// std::errc::result_out_of_range and malformed data as
+/// std::errc::illegal_byte_sequence. The failed operation leaves the stream
+/// and the output unchanged, and the error stays set until it is cleared.
+class error_code_check
+{
+public:
+    /// True since this policy never throws
+    static constexpr bool is_noexcept = true;
+
+    /// @return the recorded error, or an empty error code if every
+    ///         operation succeeded
+    std::error_code error() const noexcept
+    {
+        return m_error;
+    }
+
+    /// @return true if an operation has failed
+    bool has_error() const noexcept
+    {
+        return static_cast<bool>(m_error);
+    }
+
+    /// Clears the recorded error
+    void clear_error() noexcept
+    {
+        m_error.clear();
+    }
+
+protected:
+    /// @param condition must be true for the access to be valid
+    /// @param message describing the failed check
+    /// @return true if the access is valid, otherwise false
+    bool check(bool condition, const char* message) const noexcept
+    {
+        (void)message;
+        if (!condition)
+        {
+            m_error = std::make_error_code(std::errc::result_out_of_range);
+            return false;
+        }
+        return true;
+    }
+
+    /// @param condition must be true for the data to be well-formed
+    /// @param message describing the failed check
+    /// @return true if the data is well-formed, otherwise false
+    bool check_format(bool condition, const char* message) const noexcept
+    {
+        (void)message;
+        if (!condition)
+        {
+            m_error = std::make_error_code(std::errc::illegal_byte_sequence);
+            return false;
+        }
+        return true;
+    }
+
+private:
+    /// The recorded error
+    mutable std::error_code m_error;
+};
+}
@@ -0,0 +1,34 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace endian
+{
+/// Describes a field of a layout which is Bytes wide on the wire and accessed
+/// as ValueType. A field is named by deriving a type from it, e.g.:
+///
+///     struct length : endian::field<2, uint16_t>
+///     {
+///     };
+///
+/// The same rules as for put_bytes and get_bytes apply, i.e. fields narrower
+/// than ValueType must be unsigned.
+template <uint8_t Bytes, class ValueType>
+struct field
+{
+    static_assert(Bytes > 0 && Bytes <= sizeof(ValueType),
+                  "The field must fit in the ValueType");
+
+    /// The width of the field in bytes
+    static constexpr uint8_t bytes = Bytes;
+
+    /// The type used when accessing the field
+    using value_type = ValueType;
+};
+}
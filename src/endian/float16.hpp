@@ -0,0 +1,207 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "detail/half.hpp"
+#include "detail/helpers.hpp"
+#include "is_big_endian.hpp"
+
+namespace endian
+{
+/// An IEEE 754 binary16 (half precision) value. It is only a storage type:
+/// it converts to float for arithmetic, and a float converts to it rounding
+/// to nearest even. The value can be put, got and streamed like a float, and
+/// is stored as its 16 bits in the byte order of the EndianType.
+class float16
+{
+public:
+    /// Creates a value with undefined bits
+    float16() = default;
+
+    /// Converts a float, rounding to nearest even.
+    /// @param value the value to convert
+    float16(float value) noexcept : m_bits(detail::float_to_half(value))
+    {
+    }
+
+    /// @return the value converted to float, which is exact
+    operator float() const noexcept
+    {
+        return detail::half_to_float(m_bits);
+    }
+
+    /// Creates a value from its binary representation.
+    /// @param bits the bits of the value
+    /// @return the value
+    static float16 from_bits(uint16_t bits) noexcept
+    {
+        float16 value;
+        value.m_bits = bits;
+        return value;
+    }
+
+    /// @return the binary representation of the value
+    uint16_t bits() const noexcept
+    {
+        return m_bits;
+    }
+
+private:
+    uint16_t m_bits;
+};
+
+/// A bfloat16 (brain floating point) value, which is the upper half of a
+/// float: it has the range of a float with an 8 bit mantissa. Like float16 it
+/// is a storage type converting to and from float.
+class bfloat16
+{
+public:
+    /// Creates a value with undefined bits
+    bfloat16() = default;
+
+    /// Converts a float, rounding to nearest even.
+    /// @param value the value to convert
+    bfloat16(float value) noexcept : m_bits(detail::float_to_bfloat16(value))
+    {
+    }
+
+    /// @return the value converted to float, which is exact
+    operator float() const noexcept
+    {
+        return detail::bfloat16_to_float(m_bits);
+    }
+
+    /// Creates a value from its binary representation.
+    /// @param bits the bits of the value
+    /// @return the value
+    static bfloat16 from_bits(uint16_t bits) noexcept
+    {
+        bfloat16 value;
+        value.m_bits = bits;
+        return value;
+    }
+
+    /// @return the binary representation of the value
+    uint16_t bits() const noexcept
+    {
+        return m_bits;
+    }
+
+private:
+    uint16_t m_bits;
+};
+
+static_assert(sizeof(float16) == 2 && sizeof(bfloat16) == 2,
+              "The half precision types must have a size of 2 bytes");
+static_assert(std::is_trivially_copyable<float16>::value &&
+                  std::is_trivially_copyable<bfloat16>::value,
+              "The half precision types must be trivially copyable");
+
+namespace detail
+{
+template <>
+struct floating_point<float16>
+{
+    using UnsignedType = uint16_t;
+    static constexpr bool is_iec559 = true;
+};
+
+template <>
+struct floating_point<bfloat16>
+{
+    using UnsignedType = uint16_t;
+    static constexpr bool is_iec559 = true;
+};
+
+template <>
+struct is_floating<float16> : std::true_type
+{
+};
+
+template <>
+struct is_floating<bfloat16> : std::true_type
+{
+};
+
+template <class HalfType>
+struct half_type_format;
+
+template <>
+struct half_type_format<float16>
+{
+    static constexpr half_format value = half_format::binary16;
+};
+
+template <>
+struct half_type_format<bfloat16>
+{
+    static constexpr half_format value = half_format::bfloat16;
+};
+
+// Checks if EndianType stores values in the reverse byte order of the host.
+// This folds to a constant when the host byte order is known.
+template <class EndianType>
+inline bool is_swapped_order()
+{
+    uint8_t buffer[2];
+    EndianType::template put<uint16_t>(0x0102, buffer);
+    return (buffer[0] == 0x01) != is_big_endian();
+}
+}
+
+/// Gets an array of HalfType values stored in the byte order of EndianType,
+/// widened to float, e.g. to decode a sensor or feature stream in a single
+/// pass. Uses F16C and AVX-512 when the CPU supports them.
+/// @param values pointer to where the floats should be stored
+/// @param elements the number of values
+/// @param buffer pointer to the data buffer
+template <class EndianType, class HalfType>
+inline void get_widened_array(float* values, std::size_t elements,
+                              const uint8_t* buffer)
+{
+    assert((elements == 0 || (values != nullptr && buffer != nullptr)) &&
+           "Nullpointer provided");
+
+    const detail::half_format format = detail::half_type_format<HalfType>::value;
+    if (detail::is_swapped_order<EndianType>())
+    {
+        detail::half_array<format, true>::widen(values, buffer, elements);
+    }
+    else
+    {
+        detail::half_array<format, false>::widen(values, buffer, elements);
+    }
+}
+
+/// Inserts an array of floats into the data buffer as HalfType values in the
+/// byte order of EndianType, rounding to nearest even. Uses F16C and AVX-512
+/// when the CPU supports them.
+/// @param values pointer to the floats to put in the data buffer
+/// @param elements the number of values
+/// @param buffer pointer to the data buffer
+template <class EndianType, class HalfType>
+inline void put_narrowed_array(const float* values, std::size_t elements,
+                               uint8_t* buffer)
+{
+    assert((elements == 0 || (values != nullptr && buffer != nullptr)) &&
+           "Nullpointer provided");
+
+    const detail::half_format format = detail::half_type_format<HalfType>::value;
+    if (detail::is_swapped_order<EndianType>())
+    {
+        detail::half_array<format, true>::narrow(buffer, values, elements);
+    }
+    else
+    {
+        detail::half_array<format, false>::narrow(buffer, values, elements);
+    }
+}
+}
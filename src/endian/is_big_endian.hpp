@@ -9,13 +9,41 @@
 
 namespace endian
 {
-/// Checks if the platform is big- or little-endian.
+/// The possible byte orders of the host.
+enum class byte_order
+{
+    little,
+    big,
+    unknown
+};
+
+/// The byte order of the host, known at compile time from the byte order
+/// macros predefined by the compiler. It is byte_order::unknown when the
+/// compiler does not provide these. ENDIAN_HOST_BYTE_ORDER_KNOWN is defined
+/// when it is known.
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) &&               \
+    __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#define ENDIAN_HOST_BYTE_ORDER_KNOWN 1
+constexpr byte_order host_byte_order = byte_order::big;
+#elif defined(__BYTE_ORDER__) && defined(__ORDER_LITTLE_ENDIAN__) &&           \
+    __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+#define ENDIAN_HOST_BYTE_ORDER_KNOWN 1
+constexpr byte_order host_byte_order = byte_order::little;
+#elif defined(_MSC_VER)
+// Every architecture targeted by MSVC is little endian
+#define ENDIAN_HOST_BYTE_ORDER_KNOWN 1
+constexpr byte_order host_byte_order = byte_order::little;
+#else
+constexpr byte_order host_byte_order = byte_order::unknown;
+#endif
+
+namespace detail
+{
+/// Checks the byte order at runtime.
 ///
 /// From a test proposed here:
 /// http://stackoverflow.com/questions/1001307/
-///
-/// @return True if the platform is big endian otherwise false.
-inline bool is_big_endian()
+inline bool test_is_big_endian()
 {
     union
     {
@@ -26,3 +54,22 @@ inline bool is_big_endian()
     return test.c[0] == 1;
 }
 }
+
+/// Checks if the platform is big- or little-endian.
+///
+/// When host_byte_order is known this is a constant expression, otherwise it
+/// falls back to a runtime test and is not constexpr.
+///
+/// @return True if the platform is big endian otherwise false.
+#if defined(ENDIAN_HOST_BYTE_ORDER_KNOWN)
+constexpr bool is_big_endian()
+{
+    return host_byte_order == byte_order::big;
+}
+#else
+inline bool is_big_endian()
+{
+    return detail::test_is_big_endian();
+}
+#endif
+}
@@ -0,0 +1,129 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <tuple>
+#include <utility>
+
+#include "detail/field_offset.hpp"
+#include "field.hpp"
+
+namespace endian
+{
+/// Describes a fixed binary layout, e.g. a protocol header, as a list of
+/// fields stored back to back in the byte order of EndianType. The offset of
+/// every field and the total size are computed at compile time, so each
+/// access is a single conversion at a constant offset from the buffer.
+///
+/// Example:
+///
+///     struct version : endian::field<1, uint8_t> {};
+///     struct length : endian::field<2, uint16_t> {};
+///     struct timestamp : endian::field<6, uint64_t> {};
+///
+///     using header =
+///         endian::layout<endian::big_endian, version, length, timestamp>;
+///
+///     uint16_t l = header::get<length>(data);
+///     header::set<timestamp>(data, 1234);
+template <class EndianType, class... Fields>
+struct layout
+{
+    /// All fields decoded as host values, in the order of the layout
+    using record = std::tuple<typename Fields::value_type...>;
+
+    /// @return the size of the layout in bytes
+    static constexpr std::size_t size()
+    {
+        return detail::field_offset<sizeof...(Fields), Fields...>::value;
+    }
+
+    /// @return the index of the Field in the layout
+    template <class Field>
+    static constexpr std::size_t index()
+    {
+        return detail::field_index<Field, Fields...>::value;
+    }
+
+    /// @return the offset of the Field in bytes from the start of the layout
+    template <class Field>
+    static constexpr std::size_t offset()
+    {
+        return detail::field_offset<index<Field>(), Fields...>::value;
+    }
+
+    /// Gets the value of a field from a buffer holding the layout.
+    /// @param data pointer to the start of the layout
+    /// @return the value of the field
+    template <class Field>
+    static typename Field::value_type get(const uint8_t* data)
+    {
+        assert(data != nullptr && "Nullpointer provided");
+
+        return EndianType::template get_bytes<Field::bytes,
+                                              typename Field::value_type>(
+            data + offset<Field>());
+    }
+
+    /// Sets the value of a field in a buffer holding the layout.
+    /// @param data pointer to the start of the layout
+    /// @param value the new value of the field
+    template <class Field>
+    static void set(uint8_t* data, typename Field::value_type value)
+    {
+        assert(data != nullptr && "Nullpointer provided");
+
+        EndianType::template put_bytes<Field::bytes>(value,
+                                                      data + offset<Field>());
+    }
+
+    /// Accesses the value of a field in a decoded record.
+    /// @param values the decoded record
+    /// @return reference to the value of the field
+    template <class Field>
+    static typename Field::value_type& at(record& values)
+    {
+        return std::get<index<Field>()>(values);
+    }
+
+    /// Accesses the value of a field in a decoded record.
+    /// @param values the decoded record
+    /// @return reference to the value of the field
+    template <class Field>
+    static const typename Field::value_type& at(const record& values)
+    {
+        return std::get<index<Field>()>(values);
+    }
+
+    /// Decodes all fields of the layout.
+    /// @param data pointer to the start of the layout
+    /// @return the values of all fields
+    static record decode(const uint8_t* data)
+    {
+        return record{get<Fields>(data)...};
+    }
+
+    /// Encodes all fields of the layout.
+    /// @param values the values of all fields
+    /// @param data pointer to the start of the layout
+    static void encode(const record& values, uint8_t* data)
+    {
+        encode(values, data, std::index_sequence_for<Fields...>());
+    }
+
+private:
+    template <std::size_t... Indices>
+    static void encode(const record& values, uint8_t* data,
+                       std::index_sequence<Indices...>)
+    {
+        // Expands to one set call per field
+        int expand[] = {0, (set<Fields>(data, std::get<Indices>(values)), 0)...};
+        (void)expand;
+    }
+};
+}
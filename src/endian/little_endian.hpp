@@ -10,7 +10,10 @@
 #include <type_traits>
 
 #include "detail/helpers.hpp"
+#include "detail/packed_array.hpp"
 #include "detail/little.hpp"
+#include "detail/swap_array.hpp"
+#include "is_big_endian.hpp"
 
 namespace endian
 {
@@ -61,7 +64,7 @@ struct little_endian
     static void put_bytes(ValueType value, uint8_t* buffer)
     {
         static_assert(Bytes == sizeof(ValueType) ||
-                          std::is_unsigned<ValueType>::value,
+                          detail::is_unsigned<ValueType>::value,
                       "Must be unsigned");
         assert(buffer != nullptr && "Nullpointer provided");
         assert((detail::check<ValueType, Bytes>::value(value)) &&
@@ -77,7 +80,7 @@ struct little_endian
     static void get_bytes(ValueType& value, const uint8_t* buffer)
     {
         static_assert(Bytes == sizeof(ValueType) ||
-                          std::is_unsigned<ValueType>::value,
+                          detail::is_unsigned<ValueType>::value,
                       "Must be unsigned");
         static_assert(sizeof(ValueType) >= Bytes, "ValueType too small");
         assert(buffer != nullptr && "Nullpointer provided");
@@ -93,7 +96,7 @@ struct little_endian
     static ValueType get_bytes(const uint8_t* buffer)
     {
         static_assert(Bytes == sizeof(ValueType) ||
-                          std::is_unsigned<ValueType>::value,
+                          detail::is_unsigned<ValueType>::value,
                       "Must be unsigned");
         static_assert(sizeof(ValueType) >= Bytes, "ValueType too small");
         assert(buffer != nullptr && "Nullpointer provided");
@@ -102,5 +105,100 @@ struct little_endian
         get_bytes<Bytes>(value, buffer);
         return value;
     }
+
+    /// Inserts an array of ValueType-sized values into the data buffer.
+    /// The values are converted in bulk, using vector instructions when the
+    /// CPU supports them.
+    /// @param values pointer to the values to put in the data buffer
+    /// @param elements the number of values
+    /// @param buffer pointer to the data buffer
+    template <class ValueType>
+    static void put_array(const ValueType* values, std::size_t elements,
+                          uint8_t* buffer)
+    {
+        static_assert(detail::is_arithmetic<ValueType>::value,
+                      "Only integer and floating point types are supported");
+        assert((elements == 0 || (values != nullptr && buffer != nullptr)) &&
+               "Nullpointer provided");
+
+        const uint8_t* input = reinterpret_cast<const uint8_t*>(values);
+        if (!is_big_endian())
+        {
+            detail::copy_array(buffer, input, elements * sizeof(ValueType));
+        }
+        else
+        {
+            detail::swap_array<sizeof(ValueType)>::apply(buffer, input,
+                                                         elements);
+        }
+    }
+
+    /// Gets an array of ValueType-sized values from a data buffer.
+    /// The values are converted in bulk, using vector instructions when the
+    /// CPU supports them.
+    /// @param values pointer to where the values should be stored
+    /// @param elements the number of values
+    /// @param buffer pointer to the data buffer
+    template <class ValueType>
+    static void get_array(ValueType* values, std::size_t elements,
+                          const uint8_t* buffer)
+    {
+        static_assert(detail::is_arithmetic<ValueType>::value,
+                      "Only integer and floating point types are supported");
+        assert((elements == 0 || (values != nullptr && buffer != nullptr)) &&
+               "Nullpointer provided");
+
+        uint8_t* output = reinterpret_cast<uint8_t*>(values);
+        if (!is_big_endian())
+        {
+            detail::copy_array(output, buffer, elements * sizeof(ValueType));
+        }
+        else
+        {
+            detail::swap_array<sizeof(ValueType)>::apply(output, buffer,
+                                                         elements);
+        }
+    }
+
+    /// Inserts an array of values into the data buffer as Bytes-sized
+    /// integers packed without padding, e.g. 24 bit audio samples or 48 bit
+    /// timestamps. Only the low Bytes bytes of each value are stored. The
+    /// values are converted in bulk, using vector instructions when the CPU
+    /// supports them.
+    ///
+    /// Bytes must be 3 for 32 bit values and 5, 6 or 7 for 64 bit values.
+    /// @param values pointer to the values to put in the data buffer
+    /// @param elements the number of values
+    /// @param buffer pointer to the data buffer
+    template <uint8_t Bytes, class ValueType>
+    static void put_bytes_array(const ValueType* values, std::size_t elements,
+                                uint8_t* buffer)
+    {
+        assert((elements == 0 || (values != nullptr && buffer != nullptr)) &&
+               "Nullpointer provided");
+
+        detail::packed_array<Bytes, ValueType, byte_order::little>::put(
+            buffer, values, elements);
+    }
+
+    /// Gets an array of Bytes-sized integers packed without padding from a
+    /// data buffer. Signed values are sign extended from the top bit of the
+    /// Bytes bytes. The values are converted in bulk, using vector
+    /// instructions when the CPU supports them.
+    ///
+    /// Bytes must be 3 for 32 bit values and 5, 6 or 7 for 64 bit values.
+    /// @param values pointer to where the values should be stored
+    /// @param elements the number of values
+    /// @param buffer pointer to the data buffer
+    template <uint8_t Bytes, class ValueType>
+    static void get_bytes_array(ValueType* values, std::size_t elements,
+                                const uint8_t* buffer)
+    {
+        assert((elements == 0 || (values != nullptr && buffer != nullptr)) &&
+               "Nullpointer provided");
+
+        detail::packed_array<Bytes, ValueType, byte_order::little>::get(
+            values, buffer, elements);
+    }
 };
 }
@@ -0,0 +1,390 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cerrno>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <utility>
+
+#include "assert_check.hpp"
+#include "stream_reader.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace endian
+{
+/// How a mapped file is going to be accessed, passed on to the kernel to
+/// tune read-ahead
+enum class access_hint
+{
+    normal,
+    sequential,
+    random
+};
+
+/// Options for mapping a file
+struct map_options
+{
+    /// The expected access pattern
+    access_hint hint = access_hint::normal;
+
+    /// Read the whole window into memory when it is mapped, instead of
+    /// faulting in each page on first access. Only supported on Linux.
+    bool populate = false;
+
+    /// Ask for transparent huge pages, which reduces TLB misses on large
+    /// windows. The request is ignored where it is not supported.
+    bool huge_pages = false;
+
+    /// The largest number of bytes mapped at a time, or zero to map the whole
+    /// file. Use a window for files larger than the address space.
+    std::size_t window_size = 0;
+};
+
+/// A read-only memory mapping of a file. The data of the file is read by the
+/// kernel as it is accessed, so parsing can start right away without copying
+/// the file into memory first.
+///
+/// Files larger than the address space, or than what should be mapped at
+/// once, are mapped a window at a time. Moving the window to the position
+/// where parsing stopped continues where the previous window ended, e.g.
+///
+///     auto reader = file.reader<endian::big_endian>();
+///     ... parse whole records from the reader ...
+///     file.map(file.offset() + reader.position());
+///
+/// Errors are reported as std::system_error, or through a std::error_code
+/// with the overloads taking one.
+class mapped_file
+{
+public:
+    /// Creates a mapped_file which is not open
+    mapped_file() = default;
+
+    /// Opens and maps a file, throwing std::system_error on failure.
+    /// @param path the path of the file
+    /// @param options the mapping options
+    explicit mapped_file(const std::string& path,
+                         const map_options& options = map_options())
+    {
+        std::error_code error;
+        open(path, options, error);
+        throw_on_error(error, "Could not map the file");
+    }
+
+    mapped_file(const mapped_file&) = delete;
+    mapped_file& operator=(const mapped_file&) = delete;
+
+    mapped_file(mapped_file&& other) noexcept
+    {
+        swap(other);
+    }
+
+    mapped_file& operator=(mapped_file&& other) noexcept
+    {
+        if (this != &other)
+        {
+            close();
+            swap(other);
+        }
+        return *this;
+    }
+
+    ~mapped_file()
+    {
+        close();
+    }
+
+    /// Opens a file and maps the first window, closing any file which is
+    /// already open.
+    /// @param path the path of the file
+    /// @param options the mapping options
+    /// @param error set if the file could not be opened or mapped
+    void open(const std::string& path, const map_options& options,
+              std::error_code& error)
+    {
+        close();
+        error.clear();
+
+        m_fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+        if (m_fd < 0)
+        {
+            error = last_error();
+            return;
+        }
+
+        struct stat info;
+        if (fstat(m_fd, &info) != 0)
+        {
+            error = last_error();
+            close();
+            return;
+        }
+
+        m_options = options;
+        m_file_size = static_cast<uint64_t>(info.st_size);
+        map(0, window_size(), error);
+        if (error)
+        {
+            close();
+        }
+    }
+
+    /// Opens a file with the default options and maps it.
+    /// @param path the path of the file
+    /// @param error set if the file could not be opened or mapped
+    void open(const std::string& path, std::error_code& error)
+    {
+        open(path, map_options(), error);
+    }
+
+    /// Unmaps and closes the file. Pointers into the mapping and readers
+    /// created from it are invalid afterwards.
+    void close() noexcept
+    {
+        unmap();
+        if (m_fd >= 0)
+        {
+            ::close(m_fd);
+        }
+        m_fd = -1;
+        m_file_size = 0;
+    }
+
+    /// Maps a window of the file, replacing the current window. The window
+    /// ends early at the end of the file. Pointers into the previous window
+    /// and readers created from it are invalid afterwards.
+    /// @param offset the offset of the window in the file, which need not be
+    ///        aligned to a page
+    /// @param size the size of the window in bytes
+    /// @param error set if the window could not be mapped
+    void map(uint64_t offset, std::size_t size, std::error_code& error)
+    {
+        assert(is_open() && "The file is not open");
+        error.clear();
+
+        unmap();
+        if (offset > m_file_size)
+        {
+            error = std::make_error_code(std::errc::invalid_argument);
+            return;
+        }
+        if (m_file_size - offset < size)
+        {
+            size = static_cast<std::size_t>(m_file_size - offset);
+        }
+        if (size == 0)
+        {
+            m_offset = offset;
+            return;
+        }
+
+        // The mapping must start at a page boundary
+        const uint64_t page = static_cast<uint64_t>(sysconf(_SC_PAGESIZE));
+        const uint64_t start = offset / page * page;
+        const std::size_t delta = static_cast<std::size_t>(offset - start);
+        if (size > std::numeric_limits<std::size_t>::max() - delta ||
+            start > static_cast<uint64_t>(std::numeric_limits<off_t>::max()))
+        {
+            error = std::make_error_code(std::errc::value_too_large);
+            return;
+        }
+
+        int flags = MAP_SHARED;
+#if defined(MAP_POPULATE)
+        if (m_options.populate)
+        {
+            flags |= MAP_POPULATE;
+        }
+#endif
+        void* mapping = mmap(nullptr, size + delta, PROT_READ, flags, m_fd,
+                             static_cast<off_t>(start));
+        if (mapping == MAP_FAILED)
+        {
+            error = last_error();
+            return;
+        }
+
+        m_mapping = static_cast<uint8_t*>(mapping);
+        m_mapping_size = size + delta;
+        m_data = m_mapping + delta;
+        m_size = size;
+        m_offset = offset;
+        advise(m_options.hint);
+#if defined(MADV_HUGEPAGE)
+        if (m_options.huge_pages)
+        {
+            madvise(m_mapping, m_mapping_size, MADV_HUGEPAGE);
+        }
+#endif
+    }
+
+    /// Maps a window of the file, throwing std::system_error on failure.
+    /// @param offset the offset of the window in the file
+    /// @param size the size of the window in bytes
+    void map(uint64_t offset, std::size_t size)
+    {
+        std::error_code error;
+        map(offset, size, error);
+        throw_on_error(error, "Could not map the window");
+    }
+
+    /// Maps a window of the configured window size, throwing
+    /// std::system_error on failure.
+    /// @param offset the offset of the window in the file
+    void map(uint64_t offset)
+    {
+        map(offset, window_size());
+    }
+
+    /// Tells the kernel how the current window is going to be accessed. The
+    /// hint also applies to windows mapped later.
+    /// @param hint the expected access pattern
+    void advise(access_hint hint) noexcept
+    {
+        m_options.hint = hint;
+        if (m_mapping == nullptr)
+        {
+            return;
+        }
+
+        int advice = MADV_NORMAL;
+        if (hint == access_hint::sequential)
+        {
+            advice = MADV_SEQUENTIAL;
+        }
+        else if (hint == access_hint::random)
+        {
+            advice = MADV_RANDOM;
+        }
+        madvise(m_mapping, m_mapping_size, advice);
+    }
+
+    /// Creates a stream_reader over the current window.
+    /// @return the reader
+    template <class EndianType, class CheckPolicy = assert_check>
+    stream_reader<EndianType, CheckPolicy> reader() const noexcept
+    {
+        return stream_reader<EndianType, CheckPolicy>(m_data, m_size);
+    }
+
+    /// @return true if a file is open
+    bool is_open() const noexcept
+    {
+        return m_fd >= 0;
+    }
+
+    /// @return the size of the whole file in bytes
+    uint64_t file_size() const noexcept
+    {
+        return m_file_size;
+    }
+
+    /// @return the offset of the current window in the file
+    uint64_t offset() const noexcept
+    {
+        return m_offset;
+    }
+
+    /// @return pointer to the data of the current window, or nullptr if
+    ///         the window is empty
+    const uint8_t* data() const noexcept
+    {
+        return m_data;
+    }
+
+    /// @return the size of the current window in bytes
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @return true if the current window reaches the end of the file
+    bool at_end() const noexcept
+    {
+        return m_offset + m_size == m_file_size;
+    }
+
+private:
+    static std::error_code last_error()
+    {
+        return std::error_code(errno, std::generic_category());
+    }
+
+    static void throw_on_error(const std::error_code& error,
+                               const char* message)
+    {
+        if (error)
+        {
+            throw std::system_error(error, message);
+        }
+    }
+
+    std::size_t window_size() const noexcept
+    {
+        if (m_options.window_size != 0)
+        {
+            return m_options.window_size;
+        }
+        return m_file_size > std::numeric_limits<std::size_t>::max()
+                   ? std::numeric_limits<std::size_t>::max()
+                   : static_cast<std::size_t>(m_file_size);
+    }
+
+    void unmap() noexcept
+    {
+        if (m_mapping != nullptr)
+        {
+            munmap(m_mapping, m_mapping_size);
+        }
+        m_mapping = nullptr;
+        m_mapping_size = 0;
+        m_data = nullptr;
+        m_size = 0;
+        m_offset = 0;
+    }
+
+    void swap(mapped_file& other) noexcept
+    {
+        std::swap(m_fd, other.m_fd);
+        std::swap(m_options, other.m_options);
+        std::swap(m_file_size, other.m_file_size);
+        std::swap(m_mapping, other.m_mapping);
+        std::swap(m_mapping_size, other.m_mapping_size);
+        std::swap(m_data, other.m_data);
+        std::swap(m_size, other.m_size);
+        std::swap(m_offset, other.m_offset);
+    }
+
+private:
+    /// The file descriptor of the open file, or -1
+    int m_fd = -1;
+
+    /// The options given when the file was opened
+    map_options m_options;
+
+    /// The size of the whole file
+    uint64_t m_file_size = 0;
+
+    /// The page aligned mapping holding the current window
+    uint8_t* m_mapping = nullptr;
+    std::size_t m_mapping_size = 0;
+
+    /// The current window
+    const uint8_t* m_data = nullptr;
+    std::size_t m_size = 0;
+    uint64_t m_offset = 0;
+};
+}
+#endif
@@ -0,0 +1,111 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace endian
+{
+/// A monotonic arena handing out memory from a list of blocks. Memory is
+/// never freed individually, instead reset() makes all blocks available
+/// again without returning them to the system. This makes it possible to
+/// build many messages, e.g. with a dynamic_stream_writer using an
+/// arena_allocator, without allocating once the arena has warmed up.
+class monotonic_arena
+{
+public:
+    /// Creates an empty arena.
+    ///
+    /// @param block_size the minimum size of each block in bytes
+    explicit monotonic_arena(std::size_t block_size = 4096) :
+        m_block_size(block_size)
+    {
+        assert(block_size > 0 && "The block size must be positive");
+    }
+
+    monotonic_arena(const monotonic_arena&) = delete;
+    monotonic_arena& operator=(const monotonic_arena&) = delete;
+
+    /// Allocates memory which stays valid until the arena is reset or
+    /// destroyed.
+    ///
+    /// @param bytes the number of bytes to allocate
+    /// @param alignment the alignment of the memory, a power of two
+    /// @return pointer to the allocated memory
+    void* allocate(std::size_t bytes, std::size_t alignment)
+    {
+        assert(alignment > 0 && (alignment & (alignment - 1)) == 0 &&
+               "The alignment must be a power of two");
+
+        // Try the current block first, then any block kept by reset()
+        for (; m_current < m_blocks.size(); ++m_current, m_used = 0)
+        {
+            block& b = m_blocks[m_current];
+            const uintptr_t start =
+                reinterpret_cast<uintptr_t>(b.data.get()) + m_used;
+            const std::size_t padding = (alignment - start % alignment) %
+                                        alignment;
+            if (padding <= b.size - m_used &&
+                bytes <= b.size - m_used - padding)
+            {
+                m_used += padding + bytes;
+                return b.data.get() + m_used - bytes;
+            }
+        }
+
+        // Allocated blocks are aligned for any fundamental type, so extra
+        // space is only needed for over-aligned requests
+        const std::size_t size = std::max(m_block_size, bytes + alignment);
+        m_blocks.push_back(block{std::unique_ptr<uint8_t[]>(new uint8_t[size]),
+                                 size});
+        m_current = m_blocks.size() - 1;
+        m_used = 0;
+        return allocate(bytes, alignment);
+    }
+
+    /// Makes all memory of the arena available again. Pointers handed out
+    /// before the reset must no longer be used.
+    void reset() noexcept
+    {
+        m_current = 0;
+        m_used = 0;
+    }
+
+    /// @return the total number of bytes held by the arena
+    std::size_t capacity() const noexcept
+    {
+        std::size_t total = 0;
+        for (const block& b : m_blocks)
+        {
+            total += b.size;
+        }
+        return total;
+    }
+
+private:
+    struct block
+    {
+        std::unique_ptr<uint8_t[]> data;
+        std::size_t size;
+    };
+
+    /// The minimum size of each block
+    std::size_t m_block_size;
+
+    /// The blocks of the arena
+    std::vector<block> m_blocks;
+
+    /// The index of the block currently allocated from
+    std::size_t m_current = 0;
+
+    /// The number of bytes used in the current block
+    std::size_t m_used = 0;
+};
+}
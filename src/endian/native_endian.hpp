@@ -0,0 +1,145 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+#include "big_endian.hpp"
+#include "detail/byte_swap.hpp"
+#include "detail/swap_array.hpp"
+#include "is_big_endian.hpp"
+#include "little_endian.hpp"
+
+namespace endian
+{
+
+/// Inserts and extracts integers in the byte order of the host. Full-width
+/// values are copied as they are, so no conversion takes place. This is useful
+/// for data which never leaves the host, e.g. temporary files or shared
+/// memory, and can be used with the stream_reader and stream_writer.
+struct native_endian
+{
+    /// Inserts a ValueType-sized value into the data buffer.
+    /// @param value to put in the data buffer
+    /// @param buffer pointer to the data buffer
+    template <class ValueType>
+    static void put(ValueType value, uint8_t* buffer)
+    {
+        static_assert(detail::is_arithmetic<ValueType>::value,
+                      "Only integer and floating point types are supported");
+        assert(buffer != nullptr && "Nullpointer provided");
+
+        detail::native_order<ValueType>::put(value, buffer);
+    }
+
+    /// Gets a ValueType-sized integer value from a data buffer.
+    /// @param value variable where to get the value
+    /// @param buffer pointer to the data buffer
+    template <class ValueType>
+    static void get(ValueType& value, const uint8_t* buffer)
+    {
+        static_assert(detail::is_arithmetic<ValueType>::value,
+                      "Only integer and floating point types are supported");
+        assert(buffer != nullptr && "Nullpointer provided");
+
+        detail::native_order<ValueType>::get(value, buffer);
+    }
+
+    /// Gets a ValueType-sized integer value from a data buffer.
+    /// @return value variable where to get the value
+    /// @param buffer pointer to the data buffer
+    template <class ValueType>
+    static ValueType get(const uint8_t* buffer)
+    {
+        assert(buffer != nullptr && "Nullpointer provided");
+
+        ValueType value = 0;
+        get(value, buffer);
+        return value;
+    }
+
+    /// Inserts a Bytes-sized integer value into the data buffer.
+    /// @param value to put in the data buffer
+    /// @param buffer pointer to the data buffer
+    template <uint8_t Bytes, class ValueType>
+    static void put_bytes(ValueType value, uint8_t* buffer)
+    {
+        if (is_big_endian())
+        {
+            big_endian::put_bytes<Bytes>(value, buffer);
+        }
+        else
+        {
+            little_endian::put_bytes<Bytes>(value, buffer);
+        }
+    }
+
+    /// Gets a Bytes-sized integer value from a data buffer.
+    /// @param value variable where to get the value
+    /// @param buffer pointer to the data buffer
+    template <uint8_t Bytes, class ValueType>
+    static void get_bytes(ValueType& value, const uint8_t* buffer)
+    {
+        if (is_big_endian())
+        {
+            big_endian::get_bytes<Bytes>(value, buffer);
+        }
+        else
+        {
+            little_endian::get_bytes<Bytes>(value, buffer);
+        }
+    }
+
+    /// Gets a Bytes-sized integer value from a data buffer.
+    /// @return value variable where to get the value
+    /// @param buffer pointer to the data buffer
+    template <uint8_t Bytes, class ValueType>
+    static ValueType get_bytes(const uint8_t* buffer)
+    {
+        assert(buffer != nullptr && "Nullpointer provided");
+
+        ValueType value = 0;
+        get_bytes<Bytes>(value, buffer);
+        return value;
+    }
+
+    /// Inserts an array of ValueType-sized values into the data buffer.
+    /// @param values pointer to the values to put in the data buffer
+    /// @param elements the number of values
+    /// @param buffer pointer to the data buffer
+    template <class ValueType>
+    static void put_array(const ValueType* values, std::size_t elements,
+                          uint8_t* buffer)
+    {
+        static_assert(detail::is_arithmetic<ValueType>::value,
+                      "Only integer and floating point types are supported");
+        assert((elements == 0 || (values != nullptr && buffer != nullptr)) &&
+               "Nullpointer provided");
+
+        detail::copy_array(buffer, reinterpret_cast<const uint8_t*>(values),
+                           elements * sizeof(ValueType));
+    }
+
+    /// Gets an array of ValueType-sized values from a data buffer.
+    /// @param values pointer to where the values should be stored
+    /// @param elements the number of values
+    /// @param buffer pointer to the data buffer
+    template <class ValueType>
+    static void get_array(ValueType* values, std::size_t elements,
+                          const uint8_t* buffer)
+    {
+        static_assert(detail::is_arithmetic<ValueType>::value,
+                      "Only integer and floating point types are supported");
+        assert((elements == 0 || (values != nullptr && buffer != nullptr)) &&
+               "Nullpointer provided");
+
+        detail::copy_array(reinterpret_cast<uint8_t*>(values), buffer,
+                           elements * sizeof(ValueType));
+    }
+};
+}
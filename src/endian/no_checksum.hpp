@@ -0,0 +1,34 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+
+namespace endian
+{
+/// Checksum policy for the stream_reader and stream_writer which computes no
+/// checksum. This is the default policy and adds no work to reads and writes.
+class no_checksum
+{
+public:
+    /// False since this policy computes no checksum
+    static constexpr bool has_checksum = false;
+
+protected:
+    /// @param data ignored
+    /// @param size ignored
+    static void update_checksum(const uint8_t* data, std::size_t size) noexcept
+    {
+        (void)data;
+        (void)size;
+    }
+
+    /// Does nothing, there are no collected bytes
+    static void fold_checksum() noexcept
+    {
+    }
+};
+}
@@ -0,0 +1,86 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace endian
+{
+/// The number of readable bytes a padded_stream_reader requires after the
+/// end of its buffer
+constexpr std::size_t read_padding = 8;
+
+/// A byte buffer followed by read_padding zero bytes, which can be read by a
+/// padded_stream_reader. The padding is not part of the size of the buffer
+/// and is kept when the buffer is resized.
+class padded_buffer
+{
+public:
+    /// Creates an empty buffer
+    padded_buffer() : m_storage(read_padding, 0)
+    {
+    }
+
+    /// Creates a zero initialized buffer.
+    /// @param size the size of the buffer in bytes, without the padding
+    explicit padded_buffer(std::size_t size) : m_storage(size + read_padding, 0)
+    {
+    }
+
+    /// Creates a buffer holding a copy of the given data.
+    /// @param data pointer to the data
+    /// @param size the size of the data in bytes
+    padded_buffer(const uint8_t* data, std::size_t size) :
+        m_storage(size + read_padding, 0)
+    {
+        assert((size == 0 || data != nullptr) && "Nullpointer provided");
+        std::copy_n(data, size, m_storage.data());
+    }
+
+    /// @return pointer to the data of the buffer
+    uint8_t* data() noexcept
+    {
+        return m_storage.data();
+    }
+
+    /// @return pointer to the data of the buffer
+    const uint8_t* data() const noexcept
+    {
+        return m_storage.data();
+    }
+
+    /// @return the size of the buffer in bytes, without the padding
+    std::size_t size() const noexcept
+    {
+        return m_storage.size() - read_padding;
+    }
+
+    /// @return the size of the buffer in bytes, including the padding
+    std::size_t padded_size() const noexcept
+    {
+        return m_storage.size();
+    }
+
+    /// Changes the size of the buffer. Added bytes and the padding are zero.
+    /// @param size the new size of the buffer in bytes, without the padding
+    void resize(std::size_t size)
+    {
+        const std::size_t old_size = this->size();
+        m_storage.resize(size + read_padding, 0);
+        if (size < old_size)
+        {
+            std::fill_n(m_storage.data() + size, read_padding, uint8_t{0});
+        }
+    }
+
+private:
+    /// The data followed by the padding
+    std::vector<uint8_t> m_storage;
+};
+}
@@ -0,0 +1,154 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <type_traits>
+
+#include "assert_check.hpp"
+#include "detail/helpers.hpp"
+#include "no_checksum.hpp"
+#include "padded_buffer.hpp"
+#include "stream_reader.hpp"
+
+namespace endian
+{
+namespace detail
+{
+// Checks if EndianType stores the most significant byte first. This folds
+// to a constant when the host byte order is known.
+template <class EndianType>
+inline bool is_msb_first()
+{
+    uint8_t buffer[2];
+    EndianType::template put<uint16_t>(0x0102, buffer);
+    return buffer[0] == 0x01;
+}
+
+// Values narrower than 8 bytes, and narrower than their type, are read with
+// a single 8 byte load which may read past the value
+template <uint8_t Bytes, class ValueType>
+struct is_padded_width
+    : std::integral_constant<bool, (Bytes < 8 && Bytes < sizeof(ValueType) &&
+                                    sizeof(ValueType) <= 8)>
+{
+};
+
+// Gets a Bytes-sized value with an unaligned 8 byte load, a byte swap if
+// the byte order differs from the host, and a shift or mask
+template <class EndianType, uint8_t Bytes, class ValueType>
+inline void padded_get(ValueType& value, const uint8_t* buffer,
+                       std::true_type)
+{
+    static_assert(is_unsigned<ValueType>::value, "Must be unsigned");
+    static_assert(Bytes > sizeof(ValueType) / 2,
+                  "ValueType fits in type of half the size compared to the "
+                  "provided one, use a smaller type");
+
+    const uint64_t word = EndianType::template get<uint64_t>(buffer);
+    if (is_msb_first<EndianType>())
+    {
+        value = static_cast<ValueType>(word >> (64 - Bytes * 8));
+    }
+    else
+    {
+        const uint64_t mask = (uint64_t{1} << (Bytes * 8)) - 1;
+        value = static_cast<ValueType>(word & mask);
+    }
+}
+
+// All other values are a single access already
+template <class EndianType, uint8_t Bytes, class ValueType>
+inline void padded_get(ValueType& value, const uint8_t* buffer,
+                       std::false_type)
+{
+    EndianType::template get_bytes<Bytes>(value, buffer);
+}
+}
+
+/// A stream_reader for buffers followed by at least read_padding readable
+/// bytes, e.g. a padded_buffer. The padding allows values of 3, 5, 6 and 7
+/// bytes to be read with a single unaligned 8 byte load, a byte swap and a
+/// shift, instead of one load per byte. The padding is never part of a
+/// value, and reads are bounds checked against the size of the buffer like
+/// in the stream_reader.
+///
+/// Only read_bytes() and peek_bytes() differ from the stream_reader, the
+/// full-width reads are a single load already. In debug builds the
+/// constructor asserts that the padding is present.
+template <typename EndianType, typename CheckPolicy = assert_check,
+          typename ChecksumPolicy = no_checksum>
+class padded_stream_reader
+    : public stream_reader<EndianType, CheckPolicy, ChecksumPolicy>
+{
+    using reader_type = stream_reader<EndianType, CheckPolicy, ChecksumPolicy>;
+
+public:
+    /// Creates a reader on top of a buffer followed by padding.
+    ///
+    /// @param data a data pointer to the buffer
+    /// @param size the size of the buffer in bytes, without the padding
+    /// @param padded_size the number of readable bytes from data, which must
+    ///        be at least size + read_padding
+    padded_stream_reader(const uint8_t* data, std::size_t size,
+                         std::size_t padded_size) noexcept :
+        reader_type(data, size)
+    {
+        (void)padded_size;
+        assert(padded_size >= size && padded_size - size >= read_padding &&
+               "The buffer must be followed by read_padding bytes");
+    }
+
+    /// Creates a reader on top of a padded buffer.
+    ///
+    /// @param buffer the buffer to read
+    explicit padded_stream_reader(const padded_buffer& buffer) noexcept :
+        padded_stream_reader(buffer.data(), buffer.size(),
+                             buffer.padded_size())
+    {
+    }
+
+    /// Reads a Bytes-sized integer from the stream and moves the read position.
+    ///
+    /// @param value reference to the value to be read
+    template <uint8_t Bytes, class ValueType>
+    void read_bytes(ValueType& value) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(Bytes <= this->remaining_size(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        detail::padded_get<EndianType, Bytes>(
+            value, this->remaining_data(),
+            detail::is_padded_width<Bytes, ValueType>());
+        this->advance(Bytes);
+    }
+
+    /// Peek a Bytes-sized integer in the stream without moving the read
+    /// position
+    ///
+    /// @param value reference to the value to be read
+    /// @param offset number of bytes to offset the peeking with
+    template <uint8_t Bytes, class ValueType>
+    void peek_bytes(ValueType& value, std::size_t offset = 0) const
+        noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(Bytes <= this->remaining_size() &&
+                             offset <= this->remaining_size() - Bytes,
+                         "Peeking over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        detail::padded_get<EndianType, Bytes>(
+            value, this->remaining_data() + offset,
+            detail::is_padded_width<Bytes, ValueType>());
+    }
+};
+}
@@ -0,0 +1,256 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+#include "const_buffer.hpp"
+#include "dynamic_stream_writer.hpp"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/uio.h>
+#endif
+
+namespace endian
+{
+/// The scatter_gather_writer provides the same interface as the
+/// stream_writer, but instead of copying large blobs of raw bytes into the
+/// buffer it only records a reference to them. The endian converted values
+/// and small blobs are written to an internal buffer. The result is a list
+/// of buffers, e.g. for writev() or sendmsg(), so a payload can be sent
+/// after a header without copying it.
+///
+/// The referenced blobs must stay valid until the buffers have been used.
+template <typename EndianType>
+class scatter_gather_writer
+{
+public:
+    /// Creates a writer.
+    ///
+    /// @param copy_threshold the size in bytes from which raw bytes passed
+    ///        to write() are referenced instead of copied
+    explicit scatter_gather_writer(std::size_t copy_threshold = 256) :
+        m_copy_threshold(copy_threshold)
+    {
+    }
+
+    /// Writes a Bytes-sized integer to the stream.
+    ///
+    /// @param value the value to write.
+    template <uint8_t Bytes, class ValueType>
+    void write_bytes(ValueType value)
+    {
+        const std::size_t start = m_header.size();
+        m_header.template write_bytes<Bytes>(value);
+        copied(start);
+    }
+
+    /// Writes a Bytes-sized integer to the stream.
+    ///
+    /// @param value the value to write.
+    template <class ValueType>
+    void write(ValueType value)
+    {
+        write_bytes<sizeof(ValueType), const ValueType>(value);
+    }
+
+    /// Writes a number of values to the stream in the order given.
+    ///
+    /// @param values the values to write
+    template <class... ValueTypes>
+    void write_all(const ValueTypes&... values)
+    {
+        const std::size_t start = m_header.size();
+        m_header.write_all(values...);
+        copied(start);
+    }
+
+    /// Writes an array of ValueType-sized values to the stream. The values
+    /// are converted and therefore always copied.
+    ///
+    /// @param values pointer to the values to write
+    /// @param elements the number of values to write
+    template <class ValueType>
+    void write_array(const ValueType* values, std::size_t elements)
+    {
+        const std::size_t start = m_header.size();
+        m_header.write_array(values, elements);
+        copied(start);
+    }
+
+    /// Writes a variable-length integer (LEB128) to the stream, see
+    /// stream_writer::write_varint().
+    ///
+    /// @param value the value to write.
+    template <class ValueType>
+    void write_varint(ValueType value)
+    {
+        const std::size_t start = m_header.size();
+        m_header.write_varint(value);
+        copied(start);
+    }
+
+    /// Writes raw bytes to the stream without any endian conversion. The
+    /// bytes are referenced if there are at least copy_threshold of them,
+    /// otherwise they are copied.
+    ///
+    /// @param data Pointer to the data, to be written to the stream.
+    /// @param size Number of bytes from the data pointer.
+    void write(const uint8_t* data, std::size_t size)
+    {
+        if (size >= m_copy_threshold)
+        {
+            write_reference(data, size);
+        }
+        else
+        {
+            const std::size_t start = m_header.size();
+            m_header.write(data, size);
+            copied(start);
+        }
+    }
+
+    /// Writes raw bytes to the stream by reference, regardless of their
+    /// size. The bytes must stay valid until the buffers have been used.
+    ///
+    /// @param data Pointer to the data, to be written to the stream.
+    /// @param size Number of bytes from the data pointer.
+    void write_reference(const uint8_t* data, std::size_t size)
+    {
+        assert((data != nullptr || size == 0) && "Nullpointer provided");
+
+        if (size == 0)
+        {
+            return;
+        }
+        m_segments.push_back(segment{data, 0, size});
+        m_size += size;
+    }
+
+    /// Operator for writing given value to the end of the stream.
+    ///
+    /// @param value the value to write.
+    template <typename ValueType>
+    scatter_gather_writer& operator<<(ValueType value)
+    {
+        write(value);
+        return *this;
+    }
+
+    /// Fills a list with the buffers making up the stream, in order. The
+    /// buffers are valid until the next write or reset.
+    ///
+    /// @param buffers the list to fill, any previous content is removed
+    void buffers(std::vector<const_buffer>& buffers) const
+    {
+        buffers.clear();
+        for (const segment& s : m_segments)
+        {
+            buffers.push_back(const_buffer{pointer(s), s.size});
+        }
+    }
+
+#if defined(__unix__) || defined(__APPLE__)
+    /// Fills a list with the buffers making up the stream, in order, ready
+    /// to be passed to writev() or sendmsg(). The buffers are valid until
+    /// the next write or reset.
+    ///
+    /// @param vectors the list to fill, any previous content is removed
+    void iovecs(std::vector<iovec>& vectors) const
+    {
+        vectors.clear();
+        for (const segment& s : m_segments)
+        {
+            iovec v;
+            v.iov_base = const_cast<uint8_t*>(pointer(s));
+            v.iov_len = s.size;
+            vectors.push_back(v);
+        }
+    }
+#endif
+
+    /// @return the number of buffers making up the stream
+    std::size_t buffer_count() const noexcept
+    {
+        return m_segments.size();
+    }
+
+    /// @return the total number of bytes written, copied or referenced
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @return the number of bytes copied to the internal buffer
+    std::size_t copied_size() const noexcept
+    {
+        return m_header.size();
+    }
+
+    /// Empties the stream while keeping the internal storage, so the next
+    /// message can be written without allocating.
+    void reset() noexcept
+    {
+        m_header.reset();
+        m_segments.clear();
+        m_size = 0;
+    }
+
+private:
+    /// A part of the stream, either copied to the internal buffer at an
+    /// offset, or referenced when data is not null
+    struct segment
+    {
+        const uint8_t* data;
+        std::size_t offset;
+        std::size_t size;
+    };
+
+    /// Records the bytes written to the internal buffer since start,
+    /// extending the last segment if it was also copied.
+    ///
+    /// @param start the size of the internal buffer before the write
+    void copied(std::size_t start)
+    {
+        const std::size_t size = m_header.size() - start;
+        if (size == 0)
+        {
+            return;
+        }
+        if (!m_segments.empty() && m_segments.back().data == nullptr)
+        {
+            m_segments.back().size += size;
+        }
+        else
+        {
+            m_segments.push_back(segment{nullptr, start, size});
+        }
+        m_size += size;
+    }
+
+    /// The internal buffer may move as it grows, so copied segments are
+    /// only turned into pointers when the buffers are requested.
+    const uint8_t* pointer(const segment& s) const noexcept
+    {
+        return s.data != nullptr ? s.data : m_header.data() + s.offset;
+    }
+
+private:
+    /// The internal buffer for the converted values and small blobs
+    dynamic_stream_writer<EndianType> m_header;
+
+    /// The parts of the stream in order
+    std::vector<segment> m_segments;
+
+    /// The size from which raw bytes are referenced instead of copied
+    std::size_t m_copy_threshold;
+
+    /// The total number of bytes written
+    std::size_t m_size = 0;
+};
+}
@@ -0,0 +1,399 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include "assert_check.hpp"
+#include "const_buffer.hpp"
+#include "detail/variadic.hpp"
+#include "detail/varint.hpp"
+#include "serialized_size.hpp"
+
+namespace endian
+{
+/// The segmented_stream_reader provides the same interface as the
+/// stream_reader, but reads from a sequence of non-contiguous segments, e.g.
+/// the chunks of a ring buffer or a list of receive buffers, without first
+/// copying them into one buffer.
+///
+/// Values inside a single segment are read directly from it. Only values
+/// straddling a segment boundary are first gathered into a small buffer.
+///
+/// The segments are not copied and must outlive the reader.
+template <typename EndianType, typename CheckPolicy = assert_check>
+class segmented_stream_reader : public CheckPolicy
+{
+public:
+    /// Creates a reader over a number of segments.
+    ///
+    /// @param segments pointer to the segments in order
+    /// @param count the number of segments
+    segmented_stream_reader(const const_buffer* segments,
+                            std::size_t count) noexcept :
+        m_segments(segments), m_count(count)
+    {
+        assert((segments != nullptr || count == 0) && "Nullpointer provided");
+
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            assert((segments[i].data != nullptr || segments[i].size == 0) &&
+                   "Nullpointer provided");
+            m_size += segments[i].size;
+        }
+        move(m_cursor, 0);
+    }
+
+    /// Creates a reader over a list of segments.
+    ///
+    /// @param segments the segments in order
+    explicit segmented_stream_reader(
+        const std::vector<const_buffer>& segments) noexcept :
+        segmented_stream_reader(segments.data(), segments.size())
+    {
+    }
+
+    /// Reads a Bytes-sized integer from the stream and moves the read position.
+    ///
+    /// @param value reference to the value to be read
+    template <uint8_t Bytes, class ValueType>
+    void read_bytes(ValueType& value) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(Bytes <= remaining_size(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        uint8_t stitch[Bytes];
+        EndianType::template get_bytes<Bytes>(value,
+                                              load(m_cursor, Bytes, stitch));
+        advance(Bytes);
+    }
+
+    /// Reads a ValueType-sized integer from the stream and moves the read
+    /// position.
+    ///
+    /// @param value reference to the value to be read
+    template <class ValueType>
+    void read(ValueType& value) noexcept(CheckPolicy::is_noexcept)
+    {
+        read_bytes<sizeof(ValueType), ValueType>(value);
+    }
+
+    /// Reads a ValueType-sized integer from the stream and moves the read
+    /// position.
+    ///
+    /// @return the read value
+    template <class ValueType>
+    ValueType read() noexcept(CheckPolicy::is_noexcept)
+    {
+        ValueType value = 0;
+        read(value);
+        return value;
+    }
+
+    /// Reads a number of values from the stream in the order given and moves
+    /// the read position past all of them. The remaining size is checked once
+    /// for all values.
+    ///
+    /// @param values references to the values to be read
+    template <class... ValueTypes>
+    void read_all(ValueTypes&... values) noexcept(CheckPolicy::is_noexcept)
+    {
+        const std::size_t size = serialized_size<ValueTypes...>::value;
+        if (!this->check(size <= remaining_size(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        uint8_t stitch[size > 0 ? size : 1];
+        detail::variadic<EndianType>::get(load(m_cursor, size, stitch),
+                                          values...);
+        advance(size);
+    }
+
+    /// Reads raw bytes from the stream without any endian conversion.
+    ///
+    /// @param data The data pointer to fill into
+    /// @param size The number of bytes to fill.
+    void read(uint8_t* data, std::size_t size) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(size <= remaining_size(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        gather(m_cursor, data, size);
+        advance(size);
+    }
+
+    /// Reads an array of ValueType-sized values from the stream and moves the
+    /// read position past all of them. An array straddling segments is
+    /// gathered into the output and converted in place.
+    ///
+    /// @param values pointer to where the values should be stored
+    /// @param elements the number of values to read
+    template <class ValueType>
+    void read_array(ValueType* values,
+                    std::size_t elements) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(elements <= remaining_size() / sizeof(ValueType),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        const std::size_t size = elements * sizeof(ValueType);
+        uint8_t* output = reinterpret_cast<uint8_t*>(values);
+        EndianType::get_array(values, elements, load(m_cursor, size, output));
+        advance(size);
+    }
+
+    /// Reads a variable-length integer (LEB128) from the stream and moves the
+    /// read position past it, see stream_reader::read_varint().
+    ///
+    /// @param value reference to the value to be read
+    template <class ValueType>
+    void read_varint(ValueType& value) noexcept(CheckPolicy::is_noexcept)
+    {
+        using varint_value = detail::varint_value<ValueType>;
+
+        const std::size_t size =
+            std::min(detail::max_varint_size, remaining_size());
+        uint8_t stitch[detail::max_varint_size];
+
+        uint64_t encoded = 0;
+        std::size_t length = 0;
+        const detail::varint_error error = detail::decode_varint(
+            load(m_cursor, size, stitch), size, encoded, length);
+
+        if (!this->check(error != detail::varint_error::truncated,
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+        if (!this->check_format(error == detail::varint_error::none &&
+                                    varint_value::fits(encoded),
+                                "Overlong varint"))
+        {
+            return;
+        }
+
+        value = varint_value::decode(encoded);
+        advance(length);
+    }
+
+    /// Reads a variable-length integer (LEB128) from the stream and moves the
+    /// read position past it.
+    ///
+    /// @return the read value
+    template <class ValueType>
+    ValueType read_varint() noexcept(CheckPolicy::is_noexcept)
+    {
+        ValueType value = 0;
+        read_varint(value);
+        return value;
+    }
+
+    /// Peek a Bytes-sized integer in the stream without moving the read
+    /// position
+    ///
+    /// @param value reference to the value to be read
+    /// @param offset number of bytes to offset the peeking with
+    template <uint8_t Bytes, class ValueType>
+    void peek_bytes(ValueType& value, std::size_t offset = 0) const
+        noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(Bytes <= remaining_size() &&
+                             offset <= remaining_size() - Bytes,
+                         "Peeking over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        cursor c = m_cursor;
+        move(c, offset);
+        uint8_t stitch[Bytes];
+        EndianType::template get_bytes<Bytes>(value, load(c, Bytes, stitch));
+    }
+
+    /// Peek a ValueType-sized integer in the stream without moving the read
+    /// position
+    ///
+    /// @param value reference to the value to be read
+    /// @param offset number of bytes to offset the peeking with
+    template <class ValueType>
+    void peek(ValueType& value, std::size_t offset = 0) const
+        noexcept(CheckPolicy::is_noexcept)
+    {
+        peek_bytes<sizeof(ValueType), ValueType>(value, offset);
+    }
+
+    /// Peek a ValueType-sized integer in the stream without moving the read
+    /// position
+    ///
+    /// @param offset number of bytes to offset the peeking with
+    /// @return the peeked value
+    template <class ValueType>
+    ValueType peek(std::size_t offset = 0) const
+        noexcept(CheckPolicy::is_noexcept)
+    {
+        ValueType value = 0;
+        peek(value, offset);
+        return value;
+    }
+
+    /// Operator for reading the next value from the stream.
+    ///
+    /// @return the read value
+    template <typename ValueType>
+    segmented_stream_reader& operator>>(ValueType& value)
+    {
+        read(value);
+        return *this;
+    }
+
+    /// Changes the current read position in the stream. The position is
+    /// absolute i.e. it is always relative to the beginning of the first
+    /// segment which is position 0.
+    ///
+    /// @param new_position the new position
+    void seek(std::size_t new_position) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(new_position <= m_size,
+                         "Seeking past the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        if (new_position < m_position)
+        {
+            m_cursor = cursor{0, 0};
+            m_position = 0;
+        }
+        advance(new_position - m_position);
+    }
+
+    /// Skips over a given number of bytes in the stream
+    ///
+    /// @param bytes_to_skip the bytes to skip
+    void skip(std::size_t bytes_to_skip) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(bytes_to_skip <= remaining_size(),
+                         "Skipping past the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        advance(bytes_to_skip);
+    }
+
+    /// @return the total size of the segments in bytes
+    std::size_t size() const noexcept
+    {
+        return m_size;
+    }
+
+    /// @return the current read position in the stream
+    std::size_t position() const noexcept
+    {
+        return m_position;
+    }
+
+    /// @return the remaining number of bytes in the stream
+    std::size_t remaining_size() const noexcept
+    {
+        return m_size - m_position;
+    }
+
+    /// @return the index of the segment holding the current read position
+    std::size_t segment() const noexcept
+    {
+        return m_cursor.segment;
+    }
+
+private:
+    /// A position given as a segment and an offset into it. Except at the
+    /// end of the stream the offset is always inside the segment.
+    struct cursor
+    {
+        std::size_t segment;
+        std::size_t offset;
+    };
+
+    /// Moves a cursor forward past empty and exhausted segments
+    void move(cursor& c, std::size_t bytes) const noexcept
+    {
+        c.offset += bytes;
+        while (c.segment + 1 < m_count &&
+               c.offset >= m_segments[c.segment].size)
+        {
+            c.offset -= m_segments[c.segment].size;
+            ++c.segment;
+        }
+    }
+
+    /// Moves the read position forward without any checks
+    void advance(std::size_t bytes) noexcept
+    {
+        move(m_cursor, bytes);
+        m_position += bytes;
+    }
+
+    /// Copies bytes starting at a cursor, crossing segments as needed
+    void gather(cursor c, uint8_t* output, std::size_t bytes) const noexcept
+    {
+        while (bytes != 0)
+        {
+            const const_buffer& s = m_segments[c.segment];
+            const std::size_t n = std::min(bytes, s.size - c.offset);
+            memcpy(output, s.data + c.offset, n);
+            output += n;
+            bytes -= n;
+            c.offset += n;
+            move(c, 0);
+        }
+    }
+
+    /// @return pointer to bytes starting at a cursor, either directly into
+    ///         a segment or to the stitch buffer they have been gathered into
+    const uint8_t* load(const cursor& c, std::size_t bytes,
+                        uint8_t* stitch) const noexcept
+    {
+        if (c.segment < m_count &&
+            bytes <= m_segments[c.segment].size - c.offset)
+        {
+            return m_segments[c.segment].data + c.offset;
+        }
+
+        gather(c, stitch, bytes);
+        return stitch;
+    }
+
+private:
+    /// The segments in order
+    const const_buffer* m_segments;
+
+    /// The number of segments
+    std::size_t m_count;
+
+    /// The total size of the segments in bytes
+    std::size_t m_size = 0;
+
+    /// The current position
+    std::size_t m_position = 0;
+
+    /// The current position as a segment and offset
+    cursor m_cursor{0, 0};
+};
+}
@@ -0,0 +1,35 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+namespace endian
+{
+/// The number of bytes used when writing values of the given types to a
+/// stream_writer with write_all, or reading them with read_all. The value is
+/// known at compile time.
+///
+/// Example:
+///
+///     static_assert(serialized_size<uint8_t, uint32_t>::value == 5, "");
+template <class... ValueTypes>
+struct serialized_size;
+
+template <>
+struct serialized_size<> : std::integral_constant<std::size_t, 0>
+{
+};
+
+template <class ValueType, class... ValueTypes>
+struct serialized_size<ValueType, ValueTypes...>
+    : std::integral_constant<std::size_t,
+                             sizeof(ValueType) +
+                                 serialized_size<ValueTypes...>::value>
+{
+};
+}
@@ -9,15 +9,34 @@
 #include <cassert>
 #include <cstdint>
 
+#include "assert_check.hpp"
 #include "detail/stream.hpp"
+#include "detail/variadic.hpp"
+#include "detail/varint.hpp"
+#include "no_checksum.hpp"
+#include "serialized_size.hpp"
+#include "stream_vbyte.hpp"
 
 namespace endian
 {
 /// The stream_reader provides a stream-like interface for reading from a
 /// fixed-size buffer. All complexity regarding endianness is encapsulated.
-template <typename EndianType>
-class stream_reader : public detail::stream<detail::const_stream>
+///
+/// Every read is bounds checked once according to the CheckPolicy, which is
+/// one of unchecked, assert_check, throw_check or error_code_check. A read
+/// rejected by the policy leaves the stream and the output unchanged.
+///
+/// With the crc32c_checksum ChecksumPolicy every byte read is folded into a
+/// CRC32C as it is read, and verify_checksum() compares it with the checksum
+/// appended by the stream_writer.
+template <typename EndianType, typename CheckPolicy = assert_check,
+          typename ChecksumPolicy = no_checksum>
+class stream_reader
+    : public detail::stream<detail::const_stream, CheckPolicy, ChecksumPolicy>
 {
+    using stream_type =
+        detail::stream<detail::const_stream, CheckPolicy, ChecksumPolicy>;
+
 public:
     /// Creates an endian stream on top of a pre-allocated buffer of the
     /// specified size.
@@ -25,7 +44,7 @@ public:
     /// @param data a data pointer to the buffer
     /// @param size the size of the buffer in bytes
     stream_reader(const uint8_t* data, std::size_t size) noexcept :
-        stream(data, size)
+        stream_type(data, size)
     {
     }
 
@@ -33,13 +52,16 @@ public:
     ///
     /// @param value reference to the value to be read
     template <uint8_t Bytes, class ValueType>
-    void read_bytes(ValueType& value) noexcept
+    void read_bytes(ValueType& value) noexcept(CheckPolicy::is_noexcept)
     {
-        assert(Bytes <= remaining_size() &&
-               "Reading over the end of the underlying buffer");
+        if (!this->check(Bytes <= this->remaining_size(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
 
-        peek_bytes<Bytes, ValueType>(value);
-        skip(Bytes);
+        EndianType::template get_bytes<Bytes>(value, this->remaining_data());
+        this->advance(Bytes);
     }
 
     /// Reads a ValueType-sized integer from the stream and moves the read
@@ -47,11 +69,8 @@ public:
     ///
     /// @param value reference to the value to be read
     template <class ValueType>
-    void read(ValueType& value) noexcept
+    void read(ValueType& value) noexcept(CheckPolicy::is_noexcept)
     {
-        assert(sizeof(ValueType) <= remaining_size() &&
-               "Reading over the end of the underlying buffer");
-
         read_bytes<sizeof(ValueType), ValueType>(value);
     }
 
@@ -60,16 +79,33 @@ public:
     ///
     /// @return the read value
     template <class ValueType>
-    ValueType read() noexcept
+    ValueType read() noexcept(CheckPolicy::is_noexcept)
     {
-        assert(sizeof(ValueType) <= remaining_size() &&
-               "Reading over the end of the underlying buffer");
-
-        ValueType value;
+        ValueType value = 0;
         read(value);
         return value;
     }
 
+    /// Reads a number of values from the stream in the order given and moves
+    /// the read position past all of them. The remaining size is checked once
+    /// for all values and the position is moved once, which makes this
+    /// cheaper than reading the values one by one.
+    ///
+    /// @param values references to the values to be read
+    template <class... ValueTypes>
+    void read_all(ValueTypes&... values) noexcept(CheckPolicy::is_noexcept)
+    {
+        const std::size_t size = serialized_size<ValueTypes...>::value;
+        if (!this->check(size <= this->remaining_size(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        detail::variadic<EndianType>::get(this->remaining_data(), values...);
+        this->advance(size);
+    }
+
     /// Reads raw bytes from the stream to fill a buffer represented by
     /// a mutable storage object.
     ///
@@ -78,13 +114,140 @@ public:
     ///
     /// @param data The data pointer to fill into
     /// @param size The number of bytes to fill.
-    void read(uint8_t* data, std::size_t size) noexcept
+    void read(uint8_t* data, std::size_t size) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(size <= this->remaining_size(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        std::copy_n(this->remaining_data(), size, data);
+        this->advance(size);
+    }
+
+    /// Reads an array of ValueType-sized values from the stream and moves the
+    /// read position past all of them.
+    ///
+    /// @param values pointer to where the values should be stored
+    /// @param elements the number of values to read
+    template <class ValueType>
+    void read_array(ValueType* values,
+                    std::size_t elements) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(elements <= this->remaining_size() / sizeof(ValueType),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        EndianType::get_array(values, elements, this->remaining_data());
+        this->advance(elements * sizeof(ValueType));
+    }
+
+    /// Reads a variable-length integer (LEB128) from the stream and moves the
+    /// read position past it. The encoding is compatible with protobuf.
+    /// Unsigned types use the plain encoding (uint32, uint64) and signed
+    /// types the zigzag encoding (sint32, sint64).
+    ///
+    /// A varint running past the end of the buffer is reported like any
+    /// other read over the end. A varint which is longer than 10 bytes or
+    /// does not fit in the ValueType is reported as malformed data.
+    ///
+    /// @param value reference to the value to be read
+    template <class ValueType>
+    void read_varint(ValueType& value) noexcept(CheckPolicy::is_noexcept)
+    {
+        using varint_value = detail::varint_value<ValueType>;
+
+        uint64_t encoded = 0;
+        std::size_t length = 0;
+        const detail::varint_error error = detail::decode_varint(
+            this->remaining_data(), this->remaining_size(), encoded, length);
+
+        if (!this->check(error != detail::varint_error::truncated,
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+        if (!this->check_format(error == detail::varint_error::none &&
+                                    varint_value::fits(encoded),
+                                "Overlong varint"))
+        {
+            return;
+        }
+
+        value = varint_value::decode(encoded);
+        this->advance(length);
+    }
+
+    /// Reads a variable-length integer (LEB128) from the stream and moves the
+    /// read position past it.
+    ///
+    /// @return the read value
+    template <class ValueType>
+    ValueType read_varint() noexcept(CheckPolicy::is_noexcept)
     {
-        assert(size <= remaining_size() &&
-               "Reading over the end of the underlying buffer");
+        ValueType value = 0;
+        read_varint(value);
+        return value;
+    }
 
-        std::copy_n(remaining_data(), size, data);
-        skip(size);
+    /// Reads an array of 32 bit values written with the stream_vbyte
+    /// encoding and moves the read position past them.
+    ///
+    /// @param values pointer to where the values should be stored
+    /// @param elements the number of values to read
+    void read_vbyte_array(uint32_t* values, std::size_t elements) noexcept(
+        CheckPolicy::is_noexcept)
+    {
+        // The control bytes must be present before they can give the size
+        if (!this->check(stream_vbyte::control_size(elements) <=
+                             this->remaining_size(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        const std::size_t size =
+            stream_vbyte::encoded_size(this->remaining_data(), elements);
+        if (!this->check(size <= this->remaining_size(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        stream_vbyte::decode(this->remaining_data(), elements, values);
+        this->advance(size);
+    }
+
+    /// Reads a 32 bit checksum written by stream_writer::write_checksum()
+    /// and compares it with the checksum of the bytes read since the stream
+    /// was created or the previous checksum was verified. A new checksum is
+    /// started for the bytes that follow. Only available with a
+    /// ChecksumPolicy computing a checksum.
+    ///
+    /// A mismatch is returned rather than reported through the CheckPolicy,
+    /// since detecting corrupted data is the purpose of the call.
+    ///
+    /// @return true if the checksums match
+    bool verify_checksum() noexcept(CheckPolicy::is_noexcept)
+    {
+        static_assert(ChecksumPolicy::has_checksum,
+                      "The ChecksumPolicy must compute a checksum");
+
+        if (!this->check(sizeof(uint32_t) <= this->remaining_size(),
+                         "Reading over the end of the underlying buffer"))
+        {
+            return false;
+        }
+
+        const uint32_t expected = this->checksum();
+        const uint32_t value =
+            EndianType::template get<uint32_t>(this->remaining_data());
+        this->advance(sizeof(uint32_t));
+        this->reset_checksum();
+        return value == expected;
     }
 
     /// Peek a Bytes-sized integer in the stream without moving the read
@@ -93,13 +256,17 @@ public:
     /// @param value reference to the value to be read
     /// @param offset number of bytes to offset the peeking with
     template <uint8_t Bytes, class ValueType>
-    void peek_bytes(ValueType& value, std::size_t offset = 0) const noexcept
+    void peek_bytes(ValueType& value, std::size_t offset = 0) const
+        noexcept(CheckPolicy::is_noexcept)
     {
-        assert(remaining_size() >= offset && "Offset too large");
-        assert(Bytes <= remaining_size() - offset &&
-               "Reading over the end of the underlying buffer");
+        if (!this->check(Bytes <= this->remaining_size() &&
+                             offset <= this->remaining_size() - Bytes,
+                         "Peeking over the end of the underlying buffer"))
+        {
+            return;
+        }
 
-        const uint8_t* data_position = remaining_data() + offset;
+        const uint8_t* data_position = this->remaining_data() + offset;
         EndianType::template get_bytes<Bytes>(value, data_position);
     }
 
@@ -109,12 +276,9 @@ public:
     /// @param value reference to the value to be read
     /// @param offset number of bytes to offset the peeking with
     template <class ValueType>
-    void peek(ValueType& value, std::size_t offset = 0) const noexcept
+    void peek(ValueType& value, std::size_t offset = 0) const
+        noexcept(CheckPolicy::is_noexcept)
     {
-        assert(remaining_size() >= offset && "Offset too large");
-        assert(sizeof(ValueType) <= remaining_size() - offset &&
-               "Reading over the end of the underlying buffer");
-
         peek_bytes<sizeof(ValueType), ValueType>(value, offset);
     }
 
@@ -124,13 +288,10 @@ public:
     /// @param offset number of bytes to offset the peeking with
     /// @return the peeked value
     template <class ValueType>
-    ValueType peek(std::size_t offset = 0) const noexcept
+    ValueType peek(std::size_t offset = 0) const
+        noexcept(CheckPolicy::is_noexcept)
     {
-        assert(remaining_size() >= offset && "Offset too large");
-        assert(sizeof(ValueType) <= remaining_size() - offset &&
-               "Reading over the end of the underlying buffer");
-
-        ValueType value;
+        ValueType value = 0;
         peek(value, offset);
         return value;
     }
@@ -139,7 +300,7 @@ public:
     ///
     /// @return the read value
     template <typename ValueType>
-    stream_reader<EndianType>& operator>>(ValueType& value)
+    stream_reader& operator>>(ValueType& value)
     {
         read(value);
         return *this;
@@ -0,0 +1,292 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cassert>
+#include <cstdint>
+
+#include "cpu_features.hpp"
+#include "detail/bit_scan.hpp"
+#include "detail/byte_swap.hpp"
+#include "detail/cpuid.hpp"
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+#include <immintrin.h>
+#endif
+
+namespace endian
+{
+namespace detail
+{
+// The lookup tables used for decoding, indexed by control byte
+struct stream_vbyte_tables
+{
+    stream_vbyte_tables()
+    {
+        for (uint32_t control = 0; control < 256; ++control)
+        {
+            uint8_t offset = 0;
+            for (uint32_t j = 0; j < 4; ++j)
+            {
+                const uint8_t length = ((control >> (2 * j)) & 3) + 1;
+                for (uint8_t b = 0; b < 4; ++b)
+                {
+                    shuffle[control][4 * j + b] =
+                        b < length ? static_cast<uint8_t>(offset + b) : 0x80;
+                }
+                offset += length;
+            }
+            lengths[control] = offset;
+        }
+    }
+
+    // The shuffle moving the data of four values into 32 bit lanes
+    alignas(16) uint8_t shuffle[256][16];
+
+    // The number of data bytes used by the four values
+    uint8_t lengths[256];
+};
+
+inline const stream_vbyte_tables& stream_vbyte_table()
+{
+    static const stream_vbyte_tables tables;
+    return tables;
+}
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+// Decodes whole groups of four values, starting at the given group and
+// moving the input past the decoded data. A 16 byte load at a group stays
+// inside the data as long as three more groups follow it, since every group
+// takes at least 4 bytes. Returns the first group which was not decoded.
+ENDIAN_TARGET("ssse3")
+inline std::size_t stream_vbyte_decode_ssse3(const uint8_t* control,
+                                             const uint8_t*& input,
+                                             std::size_t group,
+                                             std::size_t groups,
+                                             uint32_t* values)
+{
+    const auto& tables = stream_vbyte_table();
+    for (; group + 4 <= groups; ++group)
+    {
+        const uint8_t c = control[group];
+        const __m128i block =
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(input));
+        const __m128i mask = _mm_load_si128(
+            reinterpret_cast<const __m128i*>(tables.shuffle[c]));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(values + 4 * group),
+                         _mm_shuffle_epi8(block, mask));
+        input += tables.lengths[c];
+    }
+    return group;
+}
+
+// Decodes two groups at a time, finishing with the SSSE3 kernel
+ENDIAN_TARGET("avx2")
+inline std::size_t stream_vbyte_decode_avx2(const uint8_t* control,
+                                            const uint8_t*& input,
+                                            std::size_t group,
+                                            std::size_t groups,
+                                            uint32_t* values)
+{
+    const auto& tables = stream_vbyte_table();
+    for (; group + 5 <= groups; group += 2)
+    {
+        const uint8_t first = control[group];
+        const uint8_t second = control[group + 1];
+        const __m256i block = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(
+                _mm_loadu_si128(reinterpret_cast<const __m128i*>(input))),
+            _mm_loadu_si128(reinterpret_cast<const __m128i*>(
+                input + tables.lengths[first])),
+            1);
+        const __m256i mask = _mm256_inserti128_si256(
+            _mm256_castsi128_si256(_mm_load_si128(
+                reinterpret_cast<const __m128i*>(tables.shuffle[first]))),
+            _mm_load_si128(
+                reinterpret_cast<const __m128i*>(tables.shuffle[second])),
+            1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(values + 4 * group),
+                            _mm256_shuffle_epi8(block, mask));
+        input += tables.lengths[first] + tables.lengths[second];
+    }
+    return stream_vbyte_decode_ssse3(control, input, group, groups, values);
+}
+#endif
+
+// The number of bytes needed to store a value, between 1 and 4
+inline uint32_t stream_vbyte_length(uint32_t value)
+{
+    return (71 - count_leading_zeros(value | 1)) / 8;
+}
+}
+
+/// Stream VByte codec for arrays of 32 bit unsigned integers, where small
+/// values take up less space. The encoding starts with one control byte for
+/// every four values, holding the length of each value minus one in two
+/// bits, starting from the least significant bits. The control bytes are
+/// followed by the values, each stored in 1 to 4 bytes in little endian
+/// byte order.
+///
+/// Decoding uses SSSE3 or AVX2 shuffles when the CPU supports it, which
+/// makes it many times faster than decoding varints.
+///
+/// See Lemire, Kurz and Rupp: "Stream VByte: Faster Byte-Oriented Integer
+/// Compression".
+struct stream_vbyte
+{
+    /// @param count the number of values
+    /// @return the number of control bytes used for the values
+    static std::size_t control_size(std::size_t count)
+    {
+        return (count + 3) / 4;
+    }
+
+    /// @param count the number of values
+    /// @return the largest number of bytes needed to encode the values
+    static std::size_t max_encoded_size(std::size_t count)
+    {
+        return control_size(count) + count * 4;
+    }
+
+    /// @param values pointer to the values
+    /// @param count the number of values
+    /// @return the number of bytes needed to encode the values
+    static std::size_t encoded_size(const uint32_t* values, std::size_t count)
+    {
+        assert((values != nullptr || count == 0) && "Nullpointer provided");
+
+        std::size_t size = control_size(count);
+        for (std::size_t i = 0; i < count; ++i)
+        {
+            size += detail::stream_vbyte_length(values[i]);
+        }
+        return size;
+    }
+
+    /// Reads the control bytes of encoded values to find their size.
+    ///
+    /// @param data pointer to the encoded values, only the control bytes
+    ///        are read
+    /// @param count the number of values
+    /// @return the number of bytes used by the encoded values
+    static std::size_t encoded_size(const uint8_t* data, std::size_t count)
+    {
+        assert((data != nullptr || count == 0) && "Nullpointer provided");
+
+        const auto& tables = detail::stream_vbyte_table();
+        const std::size_t full = count / 4;
+        std::size_t size = control_size(count);
+        for (std::size_t i = 0; i < full; ++i)
+        {
+            size += tables.lengths[data[i]];
+        }
+        for (std::size_t j = 0; j < count % 4; ++j)
+        {
+            size += ((data[full] >> (2 * j)) & 3) + 1;
+        }
+        return size;
+    }
+
+    /// Encodes a number of values.
+    ///
+    /// @param values pointer to the values
+    /// @param count the number of values
+    /// @param data pointer to where the encoded values are written, which
+    ///        must have room for max_encoded_size() bytes, or
+    ///        encoded_size() if that is known
+    /// @return the number of bytes written
+    static std::size_t encode(const uint32_t* values, std::size_t count,
+                              uint8_t* data)
+    {
+        assert(((values != nullptr && data != nullptr) || count == 0) &&
+               "Nullpointer provided");
+
+        uint8_t* control = data;
+        uint8_t* output = data + control_size(count);
+
+        // Each value is stored with a full 4 byte store. The bytes written
+        // past the end of a value are overwritten by the following values,
+        // which take at least one byte each, so only the last three values
+        // must be stored byte by byte.
+        const std::size_t fast = count > 3 ? count - 3 : 0;
+        std::size_t i = 0;
+        for (; i < fast; ++i)
+        {
+            const uint32_t length = detail::stream_vbyte_length(values[i]);
+            set_length(control, i, length);
+            detail::full_width<uint32_t, byte_order::little>::put(values[i],
+                                                                  output);
+            output += length;
+        }
+        for (; i < count; ++i)
+        {
+            const uint32_t length = detail::stream_vbyte_length(values[i]);
+            set_length(control, i, length);
+            for (uint32_t b = 0; b < length; ++b)
+            {
+                output[b] = static_cast<uint8_t>(values[i] >> (8 * b));
+            }
+            output += length;
+        }
+        return static_cast<std::size_t>(output - data);
+    }
+
+    /// Decodes a number of values.
+    ///
+    /// @param data pointer to the encoded values
+    /// @param count the number of values
+    /// @param values pointer to where the decoded values are written
+    /// @return the number of bytes read
+    static std::size_t decode(const uint8_t* data, std::size_t count,
+                              uint32_t* values)
+    {
+        assert(((values != nullptr && data != nullptr) || count == 0) &&
+               "Nullpointer provided");
+
+        const uint8_t* control = data;
+        const uint8_t* input = data + control_size(count);
+        std::size_t group = 0;
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+        const cpu_level level = active_cpu_level();
+        if (level >= cpu_level::avx2)
+        {
+            group = detail::stream_vbyte_decode_avx2(control, input, 0,
+                                                     count / 4, values);
+        }
+        else if (level >= cpu_level::ssse3)
+        {
+            group = detail::stream_vbyte_decode_ssse3(control, input, 0,
+                                                      count / 4, values);
+        }
+#endif
+
+        // Scalar tail, or all values when no vector unit is available
+        for (std::size_t i = 4 * group; i < count; ++i)
+        {
+            const uint32_t length = ((control[i / 4] >> (2 * (i % 4))) & 3) + 1;
+            uint32_t value = 0;
+            for (uint32_t b = 0; b < length; ++b)
+            {
+                value |= static_cast<uint32_t>(input[b]) << (8 * b);
+            }
+            values[i] = value;
+            input += length;
+        }
+        return static_cast<std::size_t>(input - data);
+    }
+
+private:
+    static void set_length(uint8_t* control, std::size_t i, uint32_t length)
+    {
+        if (i % 4 == 0)
+        {
+            control[i / 4] = 0;
+        }
+        control[i / 4] |= static_cast<uint8_t>((length - 1) << (2 * (i % 4)));
+    }
+};
+}
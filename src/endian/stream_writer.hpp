@@ -9,22 +9,41 @@
 #include <cassert>
 #include <cstdint>
 
+#include "assert_check.hpp"
 #include "detail/stream.hpp"
+#include "detail/variadic.hpp"
+#include "detail/varint.hpp"
+#include "no_checksum.hpp"
+#include "serialized_size.hpp"
+#include "stream_vbyte.hpp"
 
 namespace endian
 {
 /// The stream_writer provides a stream-like interface for writing to a fixed
 /// size buffer. All complexity regarding endianness is encapsulated.
-template <typename EndianType>
-class stream_writer : public detail::stream<detail::non_const_stream>
+///
+/// Every write is bounds checked once according to the CheckPolicy, which is
+/// one of unchecked, assert_check, throw_check or error_code_check. A write
+/// rejected by the policy leaves the stream and the buffer unchanged.
+///
+/// With the crc32c_checksum ChecksumPolicy every byte written is folded into
+/// a CRC32C as it is written, and write_checksum() appends it.
+template <typename EndianType, typename CheckPolicy = assert_check,
+          typename ChecksumPolicy = no_checksum>
+class stream_writer
+    : public detail::stream<detail::non_const_stream, CheckPolicy, ChecksumPolicy>
 {
+    using stream_type =
+        detail::stream<detail::non_const_stream, CheckPolicy, ChecksumPolicy>;
+
 public:
     /// Creates an endian stream on top of a pre-allocated buffer of the
     /// specified size.
     ///
     /// @param data a data pointer to the buffer
     /// @param size the size of the buffer in bytes
-    stream_writer(uint8_t* data, std::size_t size) noexcept : stream(data, size)
+    stream_writer(uint8_t* data, std::size_t size) noexcept :
+        stream_type(data, size)
     {
     }
 
@@ -32,25 +51,48 @@ public:
     ///
     /// @param value the value to write.
     template <uint8_t Bytes, class ValueType>
-    void write_bytes(ValueType value) noexcept
+    void write_bytes(ValueType value) noexcept(CheckPolicy::is_noexcept)
     {
-        assert(Bytes <= remaining_size());
+        if (!this->check(Bytes <= this->remaining_size(),
+                         "Writing over the end of the underlying buffer"))
+        {
+            return;
+        }
 
         EndianType::template put_bytes<Bytes>(value, this->remaining_data());
-        skip(Bytes);
+        this->advance(Bytes);
     }
 
     /// Writes a Bytes-sized integer to the stream.
     ///
     /// @param value the value to write.
     template <class ValueType>
-    void write(ValueType value) noexcept
+    void write(ValueType value) noexcept(CheckPolicy::is_noexcept)
     {
-        assert(sizeof(ValueType) <= remaining_size());
-
         write_bytes<sizeof(ValueType), const ValueType>(value);
     }
 
+    /// Writes a number of values to the stream in the order given. The
+    /// remaining size is checked once for all values and the position is
+    /// moved once, which makes this cheaper than writing the values one by
+    /// one.
+    ///
+    /// @param values the values to write
+    template <class... ValueTypes>
+    void write_all(const ValueTypes&... values) noexcept(
+        CheckPolicy::is_noexcept)
+    {
+        const std::size_t size = serialized_size<ValueTypes...>::value;
+        if (!this->check(size <= this->remaining_size(),
+                         "Writing over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        detail::variadic<EndianType>::put(this->remaining_data(), values...);
+        this->advance(size);
+    }
+
     /// Writes the raw bytes represented by the storage::const_storage
     /// object to the stream.
     ///
@@ -59,19 +101,104 @@ public:
     ///
     /// @param data Pointer to the data, to be written to the stream.
     /// @param size Number of bytes from the data pointer.
-    void write(const uint8_t* data, std::size_t size) noexcept
+    void write(const uint8_t* data,
+               std::size_t size) noexcept(CheckPolicy::is_noexcept)
     {
-        assert(size <= remaining_size());
+        if (!this->check(size <= this->remaining_size(),
+                         "Writing over the end of the underlying buffer"))
+        {
+            return;
+        }
 
         std::copy_n(data, size, this->remaining_data());
-        skip(size);
+        this->advance(size);
+    }
+
+    /// Writes an array of ValueType-sized values to the stream.
+    ///
+    /// @param values pointer to the values to write
+    /// @param elements the number of values to write
+    template <class ValueType>
+    void write_array(const ValueType* values,
+                     std::size_t elements) noexcept(CheckPolicy::is_noexcept)
+    {
+        if (!this->check(elements <= this->remaining_size() / sizeof(ValueType),
+                         "Writing over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        EndianType::put_array(values, elements, this->remaining_data());
+        this->advance(elements * sizeof(ValueType));
+    }
+
+    /// Writes a variable-length integer (LEB128) to the stream. The encoding
+    /// is compatible with protobuf. Unsigned types use the plain encoding
+    /// (uint32, uint64) and signed types the zigzag encoding (sint32,
+    /// sint64).
+    ///
+    /// @param value the value to write.
+    template <class ValueType>
+    void write_varint(ValueType value) noexcept(CheckPolicy::is_noexcept)
+    {
+        const uint64_t encoded = detail::varint_value<ValueType>::encode(value);
+        const std::size_t size = detail::varint_size(encoded);
+        if (!this->check(size <= this->remaining_size(),
+                         "Writing over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        detail::encode_varint(encoded, this->remaining_data());
+        this->advance(size);
+    }
+
+    /// Writes an array of 32 bit values to the stream with the stream_vbyte
+    /// encoding. The number of values is not written and must be known when
+    /// reading the values.
+    ///
+    /// @param values pointer to the values to write
+    /// @param elements the number of values to write
+    void write_vbyte_array(const uint32_t* values, std::size_t elements) noexcept(
+        CheckPolicy::is_noexcept)
+    {
+        const std::size_t size = stream_vbyte::encoded_size(values, elements);
+        if (!this->check(size <= this->remaining_size(),
+                         "Writing over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        stream_vbyte::encode(values, elements, this->remaining_data());
+        this->advance(size);
+    }
+
+    /// Writes the 32 bit checksum of the bytes written since the stream was
+    /// created or the previous checksum was written, and starts a new
+    /// checksum for the bytes that follow. Only available with a
+    /// ChecksumPolicy computing a checksum.
+    void write_checksum() noexcept(CheckPolicy::is_noexcept)
+    {
+        static_assert(ChecksumPolicy::has_checksum,
+                      "The ChecksumPolicy must compute a checksum");
+
+        if (!this->check(sizeof(uint32_t) <= this->remaining_size(),
+                         "Writing over the end of the underlying buffer"))
+        {
+            return;
+        }
+
+        EndianType::template put<uint32_t>(this->checksum(),
+                                           this->remaining_data());
+        this->advance(sizeof(uint32_t));
+        this->reset_checksum();
     }
 
     /// Operator for writing given value to the end of the stream.
     ///
     /// @param value the value to write.
     template <typename ValueType>
-    stream_writer<EndianType>& operator<<(ValueType value)
+    stream_writer& operator<<(ValueType value)
     {
         write(value);
         return *this;
@@ -0,0 +1,229 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include "cpu_features.hpp"
+#include "detail/byte_swap.hpp"
+#include "detail/cpuid.hpp"
+#include "detail/swap_array.hpp"
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+#include <immintrin.h>
+#endif
+
+namespace endian
+{
+namespace detail
+{
+// Reverses the byte order of a single full-width value
+template <class UnsignedType>
+inline void swap_value(uint8_t* data)
+{
+    UnsignedType temp;
+    memcpy(&temp, data, sizeof(UnsignedType));
+    temp = byte_swap(temp);
+    memcpy(data, &temp, sizeof(UnsignedType));
+}
+
+// Reverses the byte order of a single field of the given width
+inline void swap_field(uint8_t* data, uint8_t width)
+{
+    switch (width)
+    {
+    case 1:
+        break;
+    case 2:
+        swap_value<uint16_t>(data);
+        break;
+    case 4:
+        swap_value<uint32_t>(data);
+        break;
+    case 8:
+        swap_value<uint64_t>(data);
+        break;
+    default:
+        std::reverse(data, data + width);
+        break;
+    }
+}
+
+// Builds the shuffle mask reversing every field of as many whole records as
+// fit in a 16 byte lane. The bytes following the last whole record keep their
+// position. Returns the number of bytes covered by the whole records, or zero
+// if a record is larger than a lane.
+inline std::size_t record_mask(const uint8_t* widths, std::size_t fields,
+                               uint8_t* mask)
+{
+    std::size_t record_size = 0;
+    for (std::size_t i = 0; i < fields; ++i)
+    {
+        record_size += widths[i];
+    }
+    if (record_size == 0 || record_size > 16)
+    {
+        return 0;
+    }
+
+    const std::size_t used = (16 / record_size) * record_size;
+    for (std::size_t j = used; j < 16; ++j)
+    {
+        mask[j] = static_cast<uint8_t>(j);
+    }
+    for (std::size_t start = 0; start < used;)
+    {
+        for (std::size_t i = 0; i < fields; ++i)
+        {
+            for (std::size_t k = 0; k < widths[i]; ++k)
+            {
+                mask[start + k] =
+                    static_cast<uint8_t>(start + widths[i] - 1 - k);
+            }
+            start += widths[i];
+        }
+    }
+    return used;
+}
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+// Swaps records no larger than a lane, as many at a time as fit in a lane.
+// The bytes after the last whole record are stored unchanged and picked up
+// again by the next step. Each block is loaded before the previous one is
+// stored, as loading bytes which were just stored by an overlapping store
+// stalls the pipeline. Returns the number of bytes swapped.
+ENDIAN_TARGET("ssse3")
+inline std::size_t swap_records_ssse3(uint8_t* data, std::size_t size,
+                                      const uint8_t* indices, std::size_t used)
+{
+    const __m128i mask =
+        _mm_load_si128(reinterpret_cast<const __m128i*>(indices));
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(data));
+    std::size_t offset = 0;
+    for (; offset + used + 16 <= size; offset += used)
+    {
+        const __m128i next = _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(data + offset + used));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(data + offset),
+                         _mm_shuffle_epi8(block, mask));
+        block = next;
+    }
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(data + offset),
+                     _mm_shuffle_epi8(block, mask));
+    return offset + used;
+}
+#endif
+}
+
+/// Reverses the byte order of an array of ValueType-sized values in place,
+/// e.g. to convert a buffer from big endian to little endian or back without
+/// a second copy of the data. Uses the widest vector unit of the CPU.
+/// @param data pointer to the values
+/// @param elements the number of values
+template <class ValueType>
+inline void swap_in_place(uint8_t* data, std::size_t elements)
+{
+    static_assert(std::is_arithmetic<ValueType>::value,
+                  "Only integer and floating point types are supported");
+    assert((elements == 0 || data != nullptr) && "Nullpointer provided");
+
+    detail::swap_array<sizeof(ValueType)>::apply(data, data, elements);
+}
+
+/// Reverses the byte order of every field of an array of fixed-size records
+/// in place. Each record is made up of the fields given by the widths, in
+/// order, and the records follow each other without padding.
+/// @param data pointer to the records
+/// @param records the number of records
+/// @param widths pointer to the width in bytes of each field of a record
+/// @param fields the number of fields in a record
+inline void swap_records_in_place(uint8_t* data, std::size_t records,
+                                  const uint8_t* widths, std::size_t fields)
+{
+    assert((records == 0 || data != nullptr) && "Nullpointer provided");
+    assert(widths != nullptr && fields > 0 && "A record needs a field");
+
+    std::size_t record_size = 0;
+    for (std::size_t i = 0; i < fields; ++i)
+    {
+        assert(widths[i] > 0 && widths[i] <= 8 && "Unsupported field width");
+        record_size += widths[i];
+    }
+
+    // A record with a single field is an array of values
+    if (fields == 1)
+    {
+        switch (record_size)
+        {
+        case 1:
+            return;
+        case 2:
+            detail::swap_array<2>::apply(data, data, records);
+            return;
+        case 4:
+            detail::swap_array<4>::apply(data, data, records);
+            return;
+        case 8:
+            detail::swap_array<8>::apply(data, data, records);
+            return;
+        default:
+            break;
+        }
+    }
+
+    std::size_t offset = 0;
+    const std::size_t size = records * record_size;
+
+#if defined(ENDIAN_RUNTIME_DISPATCH)
+    alignas(16) uint8_t indices[16];
+    const std::size_t used = detail::record_mask(widths, fields, indices);
+    if (used != 0 && size >= 16 && active_cpu_level() >= cpu_level::ssse3)
+    {
+        offset = detail::swap_records_ssse3(data, size, indices, used);
+    }
+#endif
+
+    // Scalar tail, or every record when no vector unit is available
+    for (; offset != size; offset += record_size)
+    {
+        uint8_t* field = data + offset;
+        for (std::size_t i = 0; i < fields; ++i)
+        {
+            detail::swap_field(field, widths[i]);
+            field += widths[i];
+        }
+    }
+}
+
+/// Reverses the byte order of every field of an array of fixed-size records
+/// in place.
+/// @param data pointer to the records
+/// @param records the number of records
+/// @param widths the width in bytes of each field of a record
+inline void swap_records_in_place(uint8_t* data, std::size_t records,
+                                  const std::vector<uint8_t>& widths)
+{
+    swap_records_in_place(data, records, widths.data(), widths.size());
+}
+
+/// Reverses the byte order of an array of Bytes-sized values in place. Unlike
+/// swap_in_place this also supports the odd widths 3, 5, 6 and 7.
+/// @param data pointer to the values
+/// @param elements the number of values
+template <uint8_t Bytes>
+inline void swap_bytes_in_place(uint8_t* data, std::size_t elements)
+{
+    static_assert(Bytes > 0 && Bytes <= 8, "Only 1 to 8 bytes are supported");
+
+    const uint8_t width = Bytes;
+    swap_records_in_place(data, elements, &width, 1);
+}
+}
@@ -0,0 +1,47 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <stdexcept>
+
+namespace endian
+{
+/// Check policy for the stream_reader and stream_writer which throws
+/// std::out_of_range when an access would go outside the underlying buffer.
+/// Malformed data, e.g. an overlong varint, throws std::invalid_argument.
+/// The stream is left unchanged when an exception is thrown.
+class throw_check
+{
+public:
+    /// False since this policy throws on invalid access
+    static constexpr bool is_noexcept = false;
+
+protected:
+    /// @param condition must be true for the access to be valid
+    /// @param message describing the failed check
+    /// @return always true, an invalid access throws
+    static bool check(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            throw std::out_of_range(message);
+        }
+        return true;
+    }
+
+    /// @param condition must be true for the data to be well-formed
+    /// @param message describing the failed check
+    /// @return always true, malformed data throws
+    static bool check_format(bool condition, const char* message)
+    {
+        if (!condition)
+        {
+            throw std::invalid_argument(message);
+        }
+        return true;
+    }
+};
+}
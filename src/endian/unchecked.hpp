@@ -0,0 +1,40 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+namespace endian
+{
+/// Check policy for the stream_reader and stream_writer which performs no
+/// bounds checking at all. The caller must guarantee that every access stays
+/// within the underlying buffer and that the data is well-formed.
+class unchecked
+{
+public:
+    /// True since this policy never throws
+    static constexpr bool is_noexcept = true;
+
+protected:
+    /// @param condition ignored
+    /// @param message ignored
+    /// @return always true
+    static bool check(bool condition, const char* message) noexcept
+    {
+        (void)condition;
+        (void)message;
+        return true;
+    }
+
+    /// @param condition ignored
+    /// @param message ignored
+    /// @return always true
+    static bool check_format(bool condition, const char* message) noexcept
+    {
+        (void)condition;
+        (void)message;
+        return true;
+    }
+};
+}
@@ -0,0 +1,117 @@
+// Copyright (c) 2026 Steinwurf ApS
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#pragma once
+
+#include <cstdint>
+#include <type_traits>
+
+#include "big_endian.hpp"
+#include "little_endian.hpp"
+
+namespace endian
+{
+/// Stores a value as Bytes bytes in the byte order of EndianType. It has
+/// alignment 1 and is trivially copyable, so a struct made of wire values
+/// can be placed directly on top of a buffer, e.g. a received packet:
+///
+///     struct header
+///     {
+///         endian::big<uint16_t> type;
+///         endian::big_bytes<uint32_t, 3> length;
+///         endian::little<uint64_t> timestamp;
+///     };
+///
+///     const header* h = reinterpret_cast<const header*>(buffer);
+///     uint32_t length = h->length;
+///
+/// A field is only converted when it is accessed, so unused fields cost
+/// nothing. The same rules as for put_bytes and get_bytes apply, i.e. values
+/// narrower than ValueType must be unsigned.
+template <class EndianType, class ValueType, uint8_t Bytes = sizeof(ValueType)>
+class wire_value
+{
+    static_assert(detail::is_arithmetic<ValueType>::value,
+                  "Only integer and floating point types are supported");
+    static_assert(Bytes > 0 && Bytes <= sizeof(ValueType),
+                  "The value must fit in the ValueType");
+
+public:
+    /// The type of the value when loaded
+    using value_type = ValueType;
+
+    /// Leaves the bytes uninitialized, like a built-in type
+    wire_value() = default;
+
+    /// Stores a value.
+    ///
+    /// @param value the value to store
+    wire_value(ValueType value) noexcept
+    {
+        store(value);
+    }
+
+    /// Stores a value.
+    ///
+    /// @param value the value to store
+    wire_value& operator=(ValueType value) noexcept
+    {
+        store(value);
+        return *this;
+    }
+
+    /// @return the stored value
+    operator ValueType() const noexcept
+    {
+        return load();
+    }
+
+    /// @return the stored value
+    ValueType load() const noexcept
+    {
+        return EndianType::template get_bytes<Bytes, ValueType>(m_data);
+    }
+
+    /// Stores a value.
+    ///
+    /// @param value the value to store
+    void store(ValueType value) noexcept
+    {
+        EndianType::template put_bytes<Bytes>(value, m_data);
+    }
+
+    /// @return pointer to the stored bytes
+    const uint8_t* data() const noexcept
+    {
+        return m_data;
+    }
+
+    /// @return pointer to the stored bytes
+    uint8_t* data() noexcept
+    {
+        return m_data;
+    }
+
+private:
+    /// The value in wire byte order
+    uint8_t m_data[Bytes];
+};
+
+/// A ValueType stored in big endian byte order
+template <class ValueType>
+using big = wire_value<big_endian, ValueType>;
+
+/// A ValueType stored in little endian byte order
+template <class ValueType>
+using little = wire_value<little_endian, ValueType>;
+
+/// A ValueType stored in Bytes bytes in big endian byte order
+template <class ValueType, uint8_t Bytes>
+using big_bytes = wire_value<big_endian, ValueType, Bytes>;
+
+/// A ValueType stored in Bytes bytes in little endian byte order
+template <class ValueType, uint8_t Bytes>
+using little_bytes = wire_value<little_endian, ValueType, Bytes>;
+}
@@ -0,0 +1,48 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/detail/byte_swap.hpp>
+
+#include <cstdint>
+#include <cstring>
+
+#include <gtest/gtest.h>
+
+TEST(test_byte_swap, byte_swap)
+{
+    EXPECT_EQ(0x2211U, endian::detail::byte_swap((uint16_t)0x1122U));
+    EXPECT_EQ(0x44332211U, endian::detail::byte_swap((uint32_t)0x11223344U));
+    EXPECT_EQ(0x8877665544332211ULL,
+              endian::detail::byte_swap((uint64_t)0x1122334455667788ULL));
+
+    // Swapping twice gives back the original value
+    EXPECT_EQ(0xA1B2U, endian::detail::byte_swap(
+                           endian::detail::byte_swap((uint16_t)0xA1B2U)));
+    EXPECT_EQ(0xA1B2C3D4U, endian::detail::byte_swap(endian::detail::byte_swap(
+                               (uint32_t)0xA1B2C3D4U)));
+    EXPECT_EQ(0xA1B2C3D4E5F60718ULL,
+              endian::detail::byte_swap(
+                  endian::detail::byte_swap((uint64_t)0xA1B2C3D4E5F60718ULL)));
+}
+
+TEST(test_byte_swap, native_and_swapped_order)
+{
+    uint8_t data[4];
+    uint32_t input = 0x11223344U;
+
+    endian::detail::native_order<uint32_t>::put(input, data);
+    uint32_t native = 0;
+    memcpy(&native, data, sizeof(native));
+    EXPECT_EQ(input, native);
+
+    endian::detail::swapped_order<uint32_t>::put(input, data);
+    uint32_t swapped = 0;
+    memcpy(&swapped, data, sizeof(swapped));
+    EXPECT_EQ(0x44332211U, swapped);
+
+    uint32_t out = 0;
+    endian::detail::swapped_order<uint32_t>::get(out, data);
+    EXPECT_EQ(input, out);
+}
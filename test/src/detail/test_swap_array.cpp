@@ -0,0 +1,54 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/detail/swap_array.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+template <uint8_t Bytes>
+static void test_swap(std::size_t elements)
+{
+    SCOPED_TRACE(testing::Message() << "bytes: " << (uint32_t)Bytes
+                                    << " elements: " << elements);
+
+    std::vector<uint8_t> input(elements * Bytes);
+    for (std::size_t i = 0; i < input.size(); ++i)
+    {
+        input[i] = (uint8_t)i;
+    }
+
+    std::vector<uint8_t> expected(elements * Bytes);
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        for (std::size_t j = 0; j < Bytes; ++j)
+        {
+            expected[i * Bytes + j] = input[i * Bytes + Bytes - 1 - j];
+        }
+    }
+
+    std::vector<uint8_t> output(elements * Bytes);
+    endian::detail::swap_array<Bytes>::apply(output.data(), input.data(),
+                                             elements);
+    EXPECT_EQ(expected, output);
+
+    // Swapping in place must give the same result
+    endian::detail::swap_array<Bytes>::apply(input.data(), input.data(),
+                                             elements);
+    EXPECT_EQ(expected, input);
+}
+
+TEST(test_swap_array, swap)
+{
+    for (std::size_t elements : {0U, 1U, 3U, 8U, 31U, 64U, 65U, 513U})
+    {
+        test_swap<1>(elements);
+        test_swap<2>(elements);
+        test_swap<4>(elements);
+        test_swap<8>(elements);
+    }
+}
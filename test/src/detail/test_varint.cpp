@@ -0,0 +1,129 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/detail/varint.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::vector<uint8_t> encode(uint64_t value)
+{
+    std::vector<uint8_t> data(endian::detail::max_varint_size);
+    data.resize(endian::detail::encode_varint(value, data.data()));
+    return data;
+}
+}
+
+TEST(test_varint, encode)
+{
+    // Examples from the protobuf encoding documentation
+    EXPECT_EQ(std::vector<uint8_t>({0x01}), encode(1));
+    EXPECT_EQ(std::vector<uint8_t>({0x96, 0x01}), encode(150));
+    EXPECT_EQ(std::vector<uint8_t>({0xAC, 0x02}), encode(300));
+    EXPECT_EQ(std::vector<uint8_t>({0x00}), encode(0));
+    EXPECT_EQ(std::vector<uint8_t>({0x7F}), encode(127));
+    EXPECT_EQ(std::vector<uint8_t>({0x80, 0x01}), encode(128));
+    EXPECT_EQ(std::vector<uint8_t>(
+                  {0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0x01}),
+              encode(0xFFFFFFFFFFFFFFFFULL));
+
+    for (uint32_t bits = 0; bits <= 64; ++bits)
+    {
+        const uint64_t value = bits == 64 ? ~0ULL : (1ULL << bits) - 1;
+        EXPECT_EQ(bits == 0 ? 1U : (bits + 6) / 7,
+                  endian::detail::varint_size(value));
+        EXPECT_EQ(endian::detail::varint_size(value), encode(value).size());
+    }
+}
+
+TEST(test_varint, zigzag)
+{
+    EXPECT_EQ(0U, endian::detail::zigzag_encode(0));
+    EXPECT_EQ(1U, endian::detail::zigzag_encode(-1));
+    EXPECT_EQ(2U, endian::detail::zigzag_encode(1));
+    EXPECT_EQ(3U, endian::detail::zigzag_encode(-2));
+    EXPECT_EQ(4294967294U, endian::detail::zigzag_encode(2147483647));
+    EXPECT_EQ(4294967295U, endian::detail::zigzag_encode(-2147483648LL));
+    EXPECT_EQ(0xFFFFFFFFFFFFFFFFULL,
+              endian::detail::zigzag_encode(INT64_MIN));
+
+    for (int64_t value : {0LL, 1LL, -1LL, 63LL, -64LL, 1000000LL, -1000000LL,
+                          (long long)INT64_MAX, (long long)INT64_MIN})
+    {
+        EXPECT_EQ(value, endian::detail::zigzag_decode(
+                             endian::detail::zigzag_encode(value)));
+    }
+}
+
+TEST(test_varint, decode)
+{
+    // Decode every length with and without the 8 byte fast path
+    for (uint32_t bits = 0; bits <= 64; ++bits)
+    {
+        const uint64_t value =
+            bits == 64 ? 0xFEDCBA9876543210ULL
+                       : (0xFEDCBA9876543210ULL & ((1ULL << bits) - 1)) |
+                             (bits == 0 ? 0 : 1ULL << (bits - 1));
+        std::vector<uint8_t> data = encode(value);
+        const std::size_t size = data.size();
+
+        for (std::size_t padding : {0, 16})
+        {
+            data.resize(size + padding, 0xFF);
+            uint64_t decoded = 0;
+            std::size_t length = 0;
+            EXPECT_EQ(endian::detail::varint_error::none,
+                      endian::detail::decode_varint(data.data(), data.size(),
+                                                    decoded, length));
+            EXPECT_EQ(value, decoded);
+            EXPECT_EQ(size, length);
+        }
+    }
+
+    // Redundant continuation bytes are accepted
+    std::vector<uint8_t> padded = {0x81, 0x80, 0x80, 0x00};
+    uint64_t value = 0;
+    std::size_t length = 0;
+    EXPECT_EQ(endian::detail::varint_error::none,
+              endian::detail::decode_varint(padded.data(), padded.size(),
+                                            value, length));
+    EXPECT_EQ(1U, value);
+    EXPECT_EQ(4U, length);
+}
+
+TEST(test_varint, errors)
+{
+    uint64_t value = 0;
+    std::size_t length = 0;
+
+    // Ends in the middle of the varint
+    std::vector<uint8_t> truncated = {0x80, 0x80, 0x80};
+    EXPECT_EQ(endian::detail::varint_error::truncated,
+              endian::detail::decode_varint(truncated.data(), truncated.size(),
+                                            value, length));
+    EXPECT_EQ(3U, length);
+    EXPECT_EQ(endian::detail::varint_error::truncated,
+              endian::detail::decode_varint(truncated.data(), 0, value,
+                                            length));
+    EXPECT_EQ(0U, length);
+
+    // More than 10 bytes
+    std::vector<uint8_t> overlong(16, 0x80);
+    EXPECT_EQ(endian::detail::varint_error::overlong,
+              endian::detail::decode_varint(overlong.data(), overlong.size(),
+                                            value, length));
+    EXPECT_EQ(10U, length);
+
+    // The tenth byte holds more than 64 bits
+    std::vector<uint8_t> too_large = {0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+                                      0xFF, 0xFF, 0xFF, 0xFF, 0x02};
+    EXPECT_EQ(endian::detail::varint_error::overlong,
+              endian::detail::decode_varint(too_large.data(), too_large.size(),
+                                            value, length));
+}
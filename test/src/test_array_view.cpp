@@ -0,0 +1,115 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/array_view.hpp>
+#include <endian/bytes_view.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <iterator>
+#include <numeric>
+#include <type_traits>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/little_endian.hpp>
+
+#include <gtest/gtest.h>
+
+static_assert(
+    std::is_same<std::iterator_traits<endian::array_view<
+                     endian::big_endian, uint32_t>::iterator>::iterator_category,
+                 std::random_access_iterator_tag>::value,
+    "");
+
+TEST(test_array_view, algorithms)
+{
+    // Sorted big endian values at an unaligned offset
+    std::vector<uint8_t> buffer(1 + 100 * 4);
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        endian::big_endian::put<uint32_t>(i * 3, buffer.data() + 1 + i * 4);
+    }
+
+    endian::array_view<endian::big_endian, uint32_t> view(buffer.data() + 1,
+                                                          100);
+    EXPECT_EQ(100U, view.size());
+    EXPECT_EQ(400U, view.size_bytes());
+    EXPECT_EQ(0U, view.front());
+    EXPECT_EQ(297U, view.back());
+    EXPECT_EQ(30U, view[10]);
+    EXPECT_EQ(30U, view.begin()[10]);
+
+    auto it = std::lower_bound(view.begin(), view.end(), 31U);
+    EXPECT_EQ(11, it - view.begin());
+    EXPECT_EQ(33U, *it);
+
+    EXPECT_EQ(3U * 99 * 100 / 2,
+              std::accumulate(view.begin(), view.end(), 0U));
+    EXPECT_EQ(100, std::distance(view.begin(), view.end()));
+    EXPECT_EQ(297U, *std::max_element(view.begin(), view.end()));
+
+    // Convert to little endian through a mutable view
+    std::vector<uint8_t> output(400);
+    endian::mutable_array_view<endian::little_endian, uint32_t> out(
+        output.data(), 100);
+    std::transform(view.begin(), view.end(), out.begin(),
+                   [](uint32_t v) { return v + 1; });
+    EXPECT_EQ(31U, endian::little_endian::get<uint32_t>(output.data() + 40));
+    EXPECT_EQ(31U, out[10]);
+
+    // Assign through the proxy references
+    out[0] = 1000;
+    EXPECT_EQ(1000U, endian::little_endian::get<uint32_t>(output.data()));
+    *out.begin() = out[10];
+    EXPECT_EQ(31U, out[0]);
+    std::fill(out.begin(), out.end(), 5U);
+    EXPECT_EQ(500U, std::accumulate(out.cbegin(), out.cend(), 0U));
+
+    // Bulk copies
+    std::vector<uint32_t> values(100);
+    view.copy_to(values.data());
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), view.begin()));
+    out.copy_from(values.data());
+    endian::array_view<endian::little_endian, uint32_t> read_only = out;
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), read_only.begin()));
+}
+
+TEST(test_array_view, bytes_view)
+{
+    std::vector<uint8_t> buffer(10 * 3);
+    endian::mutable_bytes_view<endian::big_endian, 3, uint32_t> out(
+        buffer.data(), 10);
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        out[i] = 0x010000 * i + i;
+    }
+    EXPECT_EQ(0x010001U,
+              (endian::big_endian::get_bytes<3, uint32_t>(buffer.data() + 3)));
+
+    endian::bytes_view<endian::big_endian, 3, uint32_t> view(buffer.data(),
+                                                             10);
+    std::vector<uint32_t> values(10);
+    view.copy_to(values.data());
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(0x010000 * i + i, values[i]);
+    }
+
+    // Iterator arithmetic
+    auto it = view.end();
+    --it;
+    EXPECT_EQ(0x090009U, *it);
+    it -= 2;
+    EXPECT_EQ(0x070007U, *it);
+    EXPECT_EQ(0x080008U, *(1 + it));
+    EXPECT_TRUE(it < view.end());
+    EXPECT_EQ(7, it - view.begin());
+    EXPECT_TRUE(view.begin() + 7 == it);
+
+    endian::bytes_view<endian::little_endian, 3, uint32_t> empty(nullptr, 0);
+    EXPECT_TRUE(empty.empty());
+    EXPECT_TRUE(empty.begin() == empty.end());
+}
@@ -0,0 +1,223 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/bit_stream_reader.hpp>
+#include <endian/bit_stream_writer.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <system_error>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/error_code_check.hpp>
+#include <endian/little_endian.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(test_bit_stream, bit_order)
+{
+    // 3 bits 101 followed by 5 bits 00011 and 4 bits 1111. Only the first
+    // 2 bytes of the buffer are used.
+    std::vector<uint8_t> buffer(8);
+    endian::bit_stream_writer<endian::big_endian> big(buffer.data(), 2);
+    big.write_bits(5, 3);
+    big.write_bits(3, 5);
+    big.write_bits(15, 4);
+    big.flush();
+    EXPECT_EQ(2U, big.position());
+    EXPECT_EQ(0xA3U, buffer[0]);
+    EXPECT_EQ(0xF0U, buffer[1]);
+
+    endian::bit_stream_writer<endian::little_endian> little(buffer.data(), 2);
+    little.write_bits(5, 3);
+    little.write_bits(3, 5);
+    little.write_bits(15, 4);
+    little.flush();
+    EXPECT_EQ(0x1DU, buffer[0]);
+    EXPECT_EQ(0x0FU, buffer[1]);
+
+    endian::bit_stream_reader<endian::little_endian> reader(buffer.data(), 2);
+    EXPECT_EQ(5U, reader.read_bits(3));
+    EXPECT_EQ(3U, reader.read_bits(5));
+    EXPECT_TRUE(reader.is_aligned());
+    EXPECT_EQ(15U, reader.read_bits(4));
+    EXPECT_EQ(4U, reader.remaining_bits());
+}
+
+TEST(test_bit_stream, whole_bytes)
+{
+    // Whole bytes match the byte stream of the same endian type
+    std::vector<uint8_t> buffer(16);
+    endian::bit_stream_writer<endian::big_endian> big(buffer.data(),
+                                                      buffer.size());
+    big.write_bits(0x0102030405060708ULL, 64);
+    big.write_bits(0x0A0B, 16);
+    big.flush();
+    EXPECT_EQ(0x0102030405060708ULL,
+              endian::big_endian::get<uint64_t>(buffer.data()));
+    EXPECT_EQ(0x0A0BU, endian::big_endian::get<uint16_t>(buffer.data() + 8));
+
+    endian::bit_stream_writer<endian::little_endian> little(buffer.data(),
+                                                            buffer.size());
+    little.write_bits(0x0102030405060708ULL, 64);
+    little.write_bits(0x0A0B, 16);
+    little.flush();
+    EXPECT_EQ(0x0102030405060708ULL,
+              endian::little_endian::get<uint64_t>(buffer.data()));
+    EXPECT_EQ(0x0A0BU,
+              endian::little_endian::get<uint16_t>(buffer.data() + 8));
+}
+
+template <class EndianType>
+static void test_round_trip()
+{
+    std::mt19937_64 engine(3);
+    std::vector<uint32_t> counts(2000);
+    std::vector<uint64_t> values(counts.size());
+    std::size_t bits = 0;
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        counts[i] = engine() % 65;
+        values[i] = counts[i] == 64 ? engine()
+                                    : engine() & ((1ULL << counts[i]) - 1);
+        bits += counts[i];
+    }
+
+    std::vector<uint8_t> buffer((bits + 7) / 8);
+    endian::bit_stream_writer<EndianType> writer(buffer.data(), buffer.size());
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        writer.write_bits(values[i], counts[i]);
+    }
+    EXPECT_EQ(bits, writer.bit_position());
+    writer.flush();
+    EXPECT_EQ(buffer.size(), writer.position());
+
+    endian::bit_stream_reader<EndianType> reader(buffer.data(), buffer.size());
+    for (std::size_t i = 0; i < counts.size(); ++i)
+    {
+        ASSERT_EQ(values[i], reader.read_bits(counts[i])) << i;
+    }
+    EXPECT_EQ(bits, reader.bit_position());
+    EXPECT_LT(reader.remaining_bits(), 8U);
+
+    // Skipping lands on the same values
+    endian::bit_stream_reader<EndianType> skipper(buffer.data(), buffer.size());
+    std::size_t position = 0;
+    for (std::size_t i = 0; i + 1 < counts.size(); i += 2)
+    {
+        position += counts[i];
+        skipper.skip_bits(counts[i]);
+        ASSERT_EQ(position, skipper.bit_position());
+        ASSERT_EQ(values[i + 1], skipper.read_bits(counts[i + 1])) << i;
+        position += counts[i + 1];
+    }
+    skipper.skip_bits(0);
+}
+
+TEST(test_bit_stream, round_trip)
+{
+    test_round_trip<endian::big_endian>();
+    test_round_trip<endian::little_endian>();
+}
+
+// The bits above count are dropped, also for counts which are written in
+// two parts
+template <class EndianType>
+static void test_high_bits_ignored()
+{
+    for (uint32_t count = 57; count < 64; ++count)
+    {
+        SCOPED_TRACE(count);
+        std::vector<uint8_t> buffer(10);
+        endian::bit_stream_writer<EndianType> writer(buffer.data(),
+                                                     buffer.size());
+        writer.write_bits(0, 4);
+        writer.write_bits(~0ULL, count);
+        writer.write_bits(0, 8);
+        writer.flush();
+
+        endian::bit_stream_reader<EndianType> reader(buffer.data(),
+                                                     buffer.size());
+        EXPECT_EQ(0U, reader.read_bits(4));
+        EXPECT_EQ((1ULL << count) - 1, reader.read_bits(count));
+        EXPECT_EQ(0U, reader.read_bits(8));
+
+        // Without a leading field the value starts at the first byte
+        std::fill(buffer.begin(), buffer.end(), 0);
+        endian::bit_stream_writer<EndianType> unshifted(buffer.data(),
+                                                        buffer.size());
+        unshifted.write_bits(~0ULL, count);
+        unshifted.write_bits(0, 8);
+        unshifted.flush();
+
+        endian::bit_stream_reader<EndianType> unshifted_reader(buffer.data(),
+                                                               buffer.size());
+        EXPECT_EQ((1ULL << count) - 1, unshifted_reader.read_bits(count));
+        EXPECT_EQ(0U, unshifted_reader.read_bits(8));
+    }
+}
+
+TEST(test_bit_stream, high_bits_ignored)
+{
+    test_high_bits_ignored<endian::big_endian>();
+    test_high_bits_ignored<endian::little_endian>();
+}
+
+template <class EndianType>
+static void test_signed_and_align()
+{
+    std::vector<uint8_t> buffer(32);
+    endian::bit_stream_writer<EndianType> writer(buffer.data(), buffer.size());
+    writer.write_signed_bits(-3, 3);
+    writer.write_bit(true);
+    writer.align();
+    EXPECT_TRUE(writer.is_aligned());
+    EXPECT_EQ(8U, writer.bit_position());
+    writer.write_signed_bits(-4096, 13);
+    writer.write_signed_bits(4095, 13);
+    writer.write_signed_bits(INT64_MIN, 64);
+    writer.flush();
+
+    endian::bit_stream_reader<EndianType> reader(buffer.data(),
+                                                 writer.position());
+    EXPECT_EQ(-3, reader.read_signed_bits(3));
+    EXPECT_TRUE(reader.read_bit());
+    EXPECT_FALSE(reader.is_aligned());
+    reader.align();
+    EXPECT_EQ(8U, reader.bit_position());
+    EXPECT_EQ(-4096, reader.read_signed_bits(13));
+    EXPECT_EQ(4095, reader.read_signed_bits(13));
+    EXPECT_EQ(INT64_MIN, reader.read_signed_bits(64));
+    reader.align();
+    EXPECT_EQ(0U, reader.remaining_bits());
+}
+
+TEST(test_bit_stream, signed_and_align)
+{
+    test_signed_and_align<endian::big_endian>();
+    test_signed_and_align<endian::little_endian>();
+}
+
+TEST(test_bit_stream, error_code_check)
+{
+    std::vector<uint8_t> buffer = {0xFF, 0, 0, 0, 0, 0, 0, 0};
+    endian::bit_stream_reader<endian::big_endian, endian::error_code_check>
+        reader(buffer.data(), 1);
+    EXPECT_EQ(0x7FU, reader.read_bits(7));
+    EXPECT_EQ(0U, reader.read_bits(2));
+    EXPECT_EQ(std::errc::result_out_of_range, reader.error());
+    EXPECT_EQ(7U, reader.bit_position());
+    EXPECT_EQ(1U, reader.read_bits(1));
+
+    endian::bit_stream_writer<endian::big_endian, endian::error_code_check>
+        writer(buffer.data(), 1);
+    writer.write_bits(0, 7);
+    writer.write_bits(3, 2);
+    EXPECT_EQ(std::errc::result_out_of_range, writer.error());
+    EXPECT_EQ(7U, writer.bit_position());
+}
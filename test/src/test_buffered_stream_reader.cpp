@@ -0,0 +1,244 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/buffered_stream_reader.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <endian/big_endian.hpp>
+#include <endian/dynamic_stream_writer.hpp>
+#include <endian/error_code_check.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/throw_check.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Writes the data to the write end of a pipe in small chunks of varying
+// size, so values straddle the reads on the other end
+void write_chunks(int fd, std::vector<uint8_t> data)
+{
+    std::size_t offset = 0;
+    std::size_t chunk = 1;
+    while (offset < data.size())
+    {
+        const std::size_t size = std::min(chunk, data.size() - offset);
+        const ssize_t written = write(fd, data.data() + offset, size);
+        if (written <= 0)
+        {
+            break;
+        }
+        offset += static_cast<std::size_t>(written);
+        chunk = chunk % 37 + 1;
+    }
+    close(fd);
+}
+
+std::vector<uint8_t> make_stream(uint32_t count)
+{
+    endian::dynamic_stream_writer<endian::big_endian> writer;
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        writer.write_bytes<3>(i);
+        writer.write<uint64_t>(i * 0x0101010101ULL);
+        writer.write_varint(i * 1000);
+        writer.write<uint16_t>(static_cast<uint16_t>(i));
+    }
+    return std::vector<uint8_t>(writer.data(), writer.data() + writer.size());
+}
+
+void check_stream(endian::buffered_stream_reader<endian::big_endian>& reader,
+                  uint32_t count)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t value = 0;
+        reader.peek_bytes<3>(value);
+        EXPECT_EQ(i, value);
+        EXPECT_EQ(i * 0x0101010101ULL, reader.peek<uint64_t>(3));
+
+        value = 0;
+        reader.read_bytes<3>(value);
+        EXPECT_EQ(i, value);
+        EXPECT_EQ(i * 0x0101010101ULL, reader.read<uint64_t>());
+        EXPECT_EQ(i * 1000, reader.read_varint<uint32_t>());
+        EXPECT_EQ(static_cast<uint16_t>(i), reader.read<uint16_t>());
+    }
+}
+}
+
+TEST(test_buffered_stream_reader, pipe)
+{
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+
+    const uint32_t count = 5000;
+    const std::vector<uint8_t> data = make_stream(count);
+    std::thread writer(write_chunks, fds[1], data);
+
+    {
+        // The smallest buffers, so almost every value straddles a boundary
+        endian::buffered_stream_reader<endian::big_endian> reader(fds[0], 1);
+        check_stream(reader, count);
+        EXPECT_EQ(data.size(), reader.position());
+        EXPECT_TRUE(reader.at_end());
+        EXPECT_FALSE(reader.read_error());
+    }
+
+    writer.join();
+    close(fds[0]);
+}
+
+TEST(test_buffered_stream_reader, bulk)
+{
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+
+    endian::dynamic_stream_writer<endian::little_endian> stream;
+    std::vector<uint32_t> values(10000);
+    for (uint32_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = i * 7919;
+    }
+    stream.write<uint8_t>(42);
+    stream.write_array(values.data(), values.size());
+    for (uint32_t i = 0; i < 1000; ++i)
+    {
+        stream.write<uint8_t>(static_cast<uint8_t>(i));
+    }
+    stream.write<uint16_t>(0xBEEF);
+    std::thread writer(
+        write_chunks, fds[1],
+        std::vector<uint8_t>(stream.data(), stream.data() + stream.size()));
+
+    {
+        endian::buffered_stream_reader<endian::little_endian> reader(fds[0],
+                                                                     1000);
+        EXPECT_EQ(42U, reader.read<uint8_t>());
+
+        std::vector<uint32_t> decoded(values.size());
+        reader.read_array(decoded.data(), decoded.size());
+        EXPECT_EQ(values, decoded);
+
+        std::vector<uint8_t> bytes(500);
+        reader.read(bytes.data(), bytes.size());
+        EXPECT_EQ(static_cast<uint8_t>(499), bytes.back());
+        reader.skip(500);
+        EXPECT_EQ(0xBEEFU, reader.read<uint16_t>());
+        EXPECT_TRUE(reader.at_end());
+    }
+
+    writer.join();
+    close(fds[0]);
+}
+
+TEST(test_buffered_stream_reader, file)
+{
+    char path[] = "/tmp/endian_buffered_stream_reader_XXXXXX";
+    const int fd = mkstemp(path);
+    ASSERT_GE(fd, 0);
+    unlink(path);
+
+    const uint32_t count = 20000;
+    const std::vector<uint8_t> data = make_stream(count);
+    ASSERT_EQ(static_cast<ssize_t>(data.size()),
+              write(fd, data.data(), data.size()));
+    ASSERT_EQ(0, lseek(fd, 0, SEEK_SET));
+
+    {
+        endian::buffered_stream_reader<endian::big_endian> reader(fd, 4096);
+        check_stream(reader, count);
+        EXPECT_TRUE(reader.at_end());
+    }
+    close(fd);
+}
+
+TEST(test_buffered_stream_reader, end_of_stream)
+{
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    const uint8_t data[] = {1, 2, 3};
+    ASSERT_EQ(3, write(fds[1], data, 3));
+    close(fds[1]);
+
+    {
+        endian::buffered_stream_reader<endian::big_endian, endian::throw_check>
+            reader(fds[0]);
+        EXPECT_EQ(0x0102U, reader.read<uint16_t>());
+        EXPECT_THROW(reader.read<uint16_t>(), std::out_of_range);
+        EXPECT_EQ(3U, reader.read<uint8_t>());
+        EXPECT_TRUE(reader.at_end());
+    }
+    close(fds[0]);
+
+    // A directory can be opened but not read
+    const int directory = open("/", O_RDONLY);
+    ASSERT_GE(directory, 0);
+    {
+        endian::buffered_stream_reader<endian::big_endian,
+                                       endian::error_code_check>
+            reader(directory);
+        EXPECT_EQ(0U, reader.read<uint32_t>());
+        EXPECT_EQ(std::errc::result_out_of_range, reader.error());
+        EXPECT_TRUE(reader.at_end());
+        EXPECT_TRUE(static_cast<bool>(reader.read_error()));
+    }
+    close(directory);
+}
+
+TEST(test_buffered_stream_reader, peek_past_lookahead)
+{
+    const std::vector<uint8_t> data = make_stream(100);
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+    std::thread writer(write_chunks, fds[1], data);
+
+    {
+        using reader_type =
+            endian::buffered_stream_reader<endian::big_endian,
+                                           endian::throw_check>;
+        reader_type reader(fds[0]);
+
+        // The offset is checked before anything is buffered
+        uint32_t value = 0;
+        EXPECT_THROW(reader.peek_bytes<3>(value, reader_type::max_lookahead),
+                     std::out_of_range);
+        EXPECT_THROW(reader.peek_bytes<3>(value, 1 << 20), std::out_of_range);
+        EXPECT_EQ(0U, reader.position());
+
+        reader.peek_bytes<3>(value, reader_type::max_lookahead - 3);
+        reader.read_bytes<3>(value);
+        EXPECT_EQ(0U, value);
+        reader.skip(data.size() - 3);
+        EXPECT_TRUE(reader.at_end());
+    }
+    writer.join();
+    close(fds[0]);
+}
+
+TEST(test_buffered_stream_reader, destroy_while_waiting)
+{
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+
+    // The read-ahead thread is waiting for data which never arrives
+    {
+        endian::buffered_stream_reader<endian::big_endian> reader(fds[0]);
+        EXPECT_EQ(0U, reader.buffered_size());
+    }
+    close(fds[0]);
+    close(fds[1]);
+}
+
+#endif
@@ -0,0 +1,250 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/buffered_stream_writer.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <endian/big_endian.hpp>
+#include <endian/buffered_stream_reader.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/stream_reader.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Creates an unlinked temporary file. If direct is given, the file is also
+// opened with O_DIRECT, or direct is set to -1 if that is not supported.
+int temporary_file(int* direct = nullptr)
+{
+    const char* directory = std::getenv("TMPDIR");
+    std::string path = std::string(directory ? directory : "/tmp") +
+                       "/endian_buffered_stream_writer_XXXXXX";
+    const int fd = mkstemp(&path[0]);
+    EXPECT_GE(fd, 0);
+    if (direct != nullptr)
+    {
+#if defined(O_DIRECT)
+        *direct = open(path.c_str(), O_WRONLY | O_DIRECT);
+#else
+        *direct = -1;
+#endif
+    }
+    unlink(path.c_str());
+    return fd;
+}
+
+std::vector<uint8_t> read_file(int fd)
+{
+    struct stat info;
+    EXPECT_EQ(0, fstat(fd, &info));
+    std::vector<uint8_t> data(static_cast<std::size_t>(info.st_size));
+    EXPECT_EQ(static_cast<ssize_t>(data.size()),
+              pread(fd, data.data(), data.size(), 0));
+    return data;
+}
+
+void write_stream(endian::buffered_stream_writer<endian::big_endian>& writer,
+                  uint32_t count)
+{
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        writer.write_bytes<3>(i);
+        writer.write<uint64_t>(i * 0x0101010101ULL);
+        writer.write_varint(i * 1000);
+        writer.write_all(static_cast<uint16_t>(i), static_cast<uint8_t>(i));
+    }
+}
+
+void check_stream(const std::vector<uint8_t>& data, uint32_t count)
+{
+    endian::stream_reader<endian::big_endian> reader(data.data(),
+                                                     data.size());
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        uint32_t value = 0;
+        reader.read_bytes<3>(value);
+        EXPECT_EQ(i, value);
+        EXPECT_EQ(i * 0x0101010101ULL, reader.read<uint64_t>());
+        EXPECT_EQ(i * 1000, reader.read_varint<uint32_t>());
+        EXPECT_EQ(static_cast<uint16_t>(i), reader.read<uint16_t>());
+        EXPECT_EQ(static_cast<uint8_t>(i), reader.read<uint8_t>());
+    }
+    EXPECT_EQ(0U, reader.remaining_size());
+}
+
+void write_file(endian::write_backend backend)
+{
+    const int fd = temporary_file();
+    const uint32_t count = 20000;
+
+    // Small blocks, so values straddle the blocks and every block is in
+    // flight at times
+    endian::write_options options;
+    options.block_size = 1000;
+    options.blocks = 3;
+    options.backend = backend;
+    {
+        endian::buffered_stream_writer<endian::big_endian> writer(fd, options);
+        if (backend == endian::write_backend::thread)
+        {
+            EXPECT_EQ(endian::write_backend::thread, writer.backend());
+        }
+        write_stream(writer, count);
+        EXPECT_FALSE(writer.flush());
+        EXPECT_EQ(writer.position(),
+                  static_cast<uint64_t>(lseek(fd, 0, SEEK_CUR)));
+    }
+    check_stream(read_file(fd), count);
+    close(fd);
+}
+}
+
+TEST(test_buffered_stream_writer, file)
+{
+    write_file(endian::write_backend::automatic);
+    write_file(endian::write_backend::io_uring);
+    write_file(endian::write_backend::thread);
+}
+
+TEST(test_buffered_stream_writer, pipe)
+{
+    int fds[2];
+    ASSERT_EQ(0, pipe(fds));
+
+    const uint32_t count = 5000;
+    std::thread writer_thread([&]() {
+        endian::write_options options;
+        options.block_size = 100;
+        endian::buffered_stream_writer<endian::big_endian> writer(fds[1],
+                                                                  options);
+        EXPECT_EQ(endian::write_backend::thread, writer.backend());
+        write_stream(writer, count);
+        writer.flush();
+        close(fds[1]);
+    });
+
+    {
+        endian::buffered_stream_reader<endian::big_endian> reader(fds[0], 64);
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            uint32_t value = 0;
+            reader.read_bytes<3>(value);
+            EXPECT_EQ(i, value);
+            EXPECT_EQ(i * 0x0101010101ULL, reader.read<uint64_t>());
+            EXPECT_EQ(i * 1000, reader.read_varint<uint32_t>());
+            EXPECT_EQ(static_cast<uint16_t>(i), reader.read<uint16_t>());
+            EXPECT_EQ(static_cast<uint8_t>(i), reader.read<uint8_t>());
+        }
+        EXPECT_TRUE(reader.at_end());
+    }
+
+    writer_thread.join();
+    close(fds[0]);
+}
+
+TEST(test_buffered_stream_writer, bulk)
+{
+    const int fd = temporary_file();
+    std::vector<uint32_t> values(10000);
+    for (uint32_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = i * 7919;
+    }
+
+    endian::write_options options;
+    options.block_size = 1001;
+    {
+        endian::buffered_stream_writer<endian::little_endian> writer(fd,
+                                                                     options);
+        writer << uint8_t{42};
+        writer.write_array(values.data(), values.size());
+        std::vector<uint8_t> bytes(5000, 0xAB);
+        writer.write(bytes.data(), bytes.size());
+        EXPECT_EQ(1U + 40000U + 5000U, writer.position());
+    }
+
+    const std::vector<uint8_t> data = read_file(fd);
+    ASSERT_EQ(45001U, data.size());
+    endian::stream_reader<endian::little_endian> reader(data.data(),
+                                                        data.size());
+    EXPECT_EQ(42U, reader.read<uint8_t>());
+    std::vector<uint32_t> decoded(values.size());
+    reader.read_array(decoded.data(), decoded.size());
+    EXPECT_EQ(values, decoded);
+    EXPECT_EQ(0xABU, data.back());
+    close(fd);
+}
+
+TEST(test_buffered_stream_writer, aligned)
+{
+    // O_DIRECT is not supported by every file system, e.g. tmpfs, in which
+    // case the aligned writes go through the page cache
+    int direct = -1;
+    const int fd = temporary_file(&direct);
+    const int output = direct >= 0 ? direct : fd;
+
+    const uint32_t count = 3000;
+    endian::write_options options;
+    options.block_size = 10000;
+    options.alignment = 4096;
+    {
+        endian::buffered_stream_writer<endian::big_endian> writer(output,
+                                                                  options);
+        write_stream(writer, count / 2);
+
+        // The partial block is written padded and the padding truncated
+        EXPECT_FALSE(writer.flush());
+        EXPECT_EQ(writer.position(), read_file(fd).size());
+
+        // The writes continue in the partial block
+        for (uint32_t i = count / 2; i < count; ++i)
+        {
+            writer.write_bytes<3>(i);
+            writer.write<uint64_t>(i * 0x0101010101ULL);
+            writer.write_varint(i * 1000);
+            writer.write_all(static_cast<uint16_t>(i),
+                             static_cast<uint8_t>(i));
+        }
+    }
+    check_stream(read_file(fd), count);
+    if (direct >= 0)
+    {
+        close(direct);
+    }
+    close(fd);
+}
+
+TEST(test_buffered_stream_writer, error)
+{
+    // A file descriptor opened for reading cannot be written
+    const int fd = open("/dev/null", O_RDONLY);
+    ASSERT_GE(fd, 0);
+    {
+        endian::write_options options;
+        options.block_size = 16;
+        endian::buffered_stream_writer<endian::big_endian> writer(fd, options);
+        for (uint32_t i = 0; i < 100; ++i)
+        {
+            writer.write<uint32_t>(i);
+        }
+        EXPECT_EQ(std::errc::bad_file_descriptor, writer.flush());
+        EXPECT_EQ(std::errc::bad_file_descriptor, writer.write_error());
+    }
+    close(fd);
+}
+
+#endif
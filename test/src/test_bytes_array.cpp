@@ -0,0 +1,120 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/big_endian.hpp>
+#include <endian/little_endian.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include <endian/cpu_features.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Converts a number of values at the active level and compares them with
+// the value by value conversions. Signed values are compared with the
+// unsigned value sign extended by hand.
+template <class EndianType, uint8_t Bytes, class ValueType>
+void check_bytes_array(std::size_t elements)
+{
+    using UnsignedType = typename std::make_unsigned<ValueType>::type;
+    SCOPED_TRACE(testing::Message() << "bytes: " << int{Bytes}
+                                    << " elements: " << elements);
+
+    std::vector<uint8_t> buffer(elements * Bytes);
+    uint32_t state = 12345;
+    for (uint8_t& byte : buffer)
+    {
+        state = state * 1664525 + 1013904223;
+        byte = static_cast<uint8_t>(state >> 24);
+    }
+
+    std::vector<ValueType> values(elements + 1, 0x55);
+    EndianType::template get_bytes_array<Bytes>(values.data(), elements,
+                                                buffer.data());
+    const UnsignedType sign = UnsignedType{1} << (Bytes * 8 - 1);
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        UnsignedType expected = 0;
+        EndianType::template get_bytes<Bytes>(expected,
+                                              buffer.data() + i * Bytes);
+        if (std::is_signed<ValueType>::value && (expected & sign) != 0)
+        {
+            expected |= ~((sign << 1) - 1);
+        }
+        ASSERT_EQ(static_cast<ValueType>(expected), values[i]) << i;
+    }
+    // Nothing is written past the values
+    EXPECT_EQ(0x55, values[elements]);
+
+    std::vector<uint8_t> packed(elements * Bytes + 1, 0xAA);
+    EndianType::template put_bytes_array<Bytes>(values.data(), elements,
+                                                packed.data());
+    EXPECT_EQ(0xAAU, packed.back());
+    packed.pop_back();
+    EXPECT_EQ(buffer, packed);
+}
+
+template <class EndianType>
+void check_endian()
+{
+    for (std::size_t elements : {0U, 1U, 5U, 16U, 33U, 100U, 1027U})
+    {
+        check_bytes_array<EndianType, 3, uint32_t>(elements);
+        check_bytes_array<EndianType, 3, int32_t>(elements);
+        check_bytes_array<EndianType, 5, uint64_t>(elements);
+        check_bytes_array<EndianType, 5, int64_t>(elements);
+        check_bytes_array<EndianType, 6, uint64_t>(elements);
+        check_bytes_array<EndianType, 6, int64_t>(elements);
+        check_bytes_array<EndianType, 7, uint64_t>(elements);
+        check_bytes_array<EndianType, 7, int64_t>(elements);
+    }
+}
+}
+
+TEST(test_bytes_array, convert)
+{
+    for (int i = 0; i <= static_cast<int>(endian::cpu_level::avx512bw); ++i)
+    {
+        const auto level = static_cast<endian::cpu_level>(i);
+        SCOPED_TRACE(endian::cpu_level_name(level));
+        endian::set_cpu_level(level);
+
+        check_endian<endian::big_endian>();
+        check_endian<endian::little_endian>();
+    }
+    endian::reset_cpu_level();
+}
+
+TEST(test_bytes_array, sign_extension)
+{
+    const uint8_t data[] = {0x80, 0x00, 0x00, 0x7F, 0xFF, 0xFF, 0xFF, 0xFF,
+                            0xFE, 0x00, 0x00, 0x01};
+    int32_t samples[4];
+    endian::big_endian::get_bytes_array<3>(samples, 4, data);
+    EXPECT_EQ(-8388608, samples[0]);
+    EXPECT_EQ(8388607, samples[1]);
+    EXPECT_EQ(-2, samples[2]);
+    EXPECT_EQ(1, samples[3]);
+
+    uint32_t unsigned_samples[4];
+    endian::little_endian::get_bytes_array<3>(unsigned_samples, 4, data);
+    EXPECT_EQ(0x000080U, unsigned_samples[0]);
+    EXPECT_EQ(0xFFFF7FU, unsigned_samples[1]);
+
+    int64_t timestamps[2];
+    endian::little_endian::get_bytes_array<6>(timestamps, 2, data);
+    EXPECT_EQ(0xFFFF7F000080LL - 0x1000000000000LL, timestamps[0]);
+    EXPECT_EQ(0x010000FEFFFFLL, timestamps[1]);
+
+    // Negative values are stored as their low bytes
+    uint8_t out[12];
+    endian::big_endian::put_bytes_array<3>(samples, 4, out);
+    EXPECT_EQ(0, std::memcmp(out, data, sizeof(data)));
+}
@@ -0,0 +1,146 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/cpu_features.hpp>
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/stream_vbyte.hpp>
+#include <endian/swap_in_place.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Runs the bulk conversions at the active level and compares them with the
+// value by value conversions
+void check_kernels()
+{
+    std::vector<uint64_t> values(203);
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = 0x0102030405060708ULL * (i + 1);
+    }
+
+    std::vector<uint8_t> buffer(values.size() * 8);
+    endian::big_endian::put_array(values.data(), values.size(), buffer.data());
+    for (std::size_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(values[i],
+                  endian::big_endian::get<uint64_t>(buffer.data() + i * 8));
+    }
+
+    std::vector<uint16_t> shorts(values.size() * 4);
+    endian::big_endian::get_array(shorts.data(), shorts.size(), buffer.data());
+    for (std::size_t i = 0; i < shorts.size(); ++i)
+    {
+        EXPECT_EQ(endian::big_endian::get<uint16_t>(buffer.data() + i * 2),
+                  shorts[i]);
+    }
+
+    std::vector<uint8_t> swapped = buffer;
+    endian::swap_in_place<uint32_t>(swapped.data(), values.size() * 2);
+    for (std::size_t i = 0; i < values.size() * 2; ++i)
+    {
+        const std::size_t offset = i * 4;
+        EXPECT_EQ(
+            endian::big_endian::get<uint32_t>(buffer.data() + offset),
+            endian::little_endian::get<uint32_t>(swapped.data() + offset));
+    }
+
+    std::vector<uint8_t> records(buffer.begin(), buffer.begin() + 5 * 100);
+    endian::swap_bytes_in_place<5>(records.data(), 100);
+    for (std::size_t i = 0; i < 100; ++i)
+    {
+        EXPECT_EQ((endian::big_endian::get_bytes<5, uint64_t>(
+                      buffer.data() + i * 5)),
+                  (endian::little_endian::get_bytes<5, uint64_t>(
+                      records.data() + i * 5)));
+    }
+
+    std::vector<uint32_t> integers(301);
+    for (std::size_t i = 0; i < integers.size(); ++i)
+    {
+        integers[i] =
+            static_cast<uint32_t>(values[i % values.size()] >> (i % 32));
+    }
+    std::vector<uint8_t> encoded(
+        endian::stream_vbyte::max_encoded_size(integers.size()));
+    const std::size_t size = endian::stream_vbyte::encode(
+        integers.data(), integers.size(), encoded.data());
+    std::vector<uint32_t> decoded(integers.size());
+    EXPECT_EQ(size, endian::stream_vbyte::decode(
+                        encoded.data(), decoded.size(), decoded.data()));
+    EXPECT_EQ(integers, decoded);
+}
+}
+
+TEST(test_cpu_features, detect)
+{
+    const endian::cpu_features& features = endian::detected_cpu_features();
+    const endian::cpu_level level = endian::detected_cpu_level();
+
+    // The features the compiler was told to assume must be detected
+#if defined(__SSE2__) && defined(ENDIAN_RUNTIME_DISPATCH)
+    EXPECT_TRUE(features.sse2);
+#endif
+#if defined(__SSSE3__) && defined(ENDIAN_RUNTIME_DISPATCH)
+    EXPECT_TRUE(features.ssse3);
+    EXPECT_GE(level, endian::cpu_level::ssse3);
+#endif
+#if defined(__AVX2__) && defined(ENDIAN_RUNTIME_DISPATCH)
+    EXPECT_TRUE(features.avx2);
+    EXPECT_GE(level, endian::cpu_level::avx2);
+#endif
+#if defined(__SSE4_2__) && defined(ENDIAN_RUNTIME_DISPATCH)
+    EXPECT_TRUE(features.sse42);
+#endif
+#if defined(__BMI2__) && defined(ENDIAN_RUNTIME_DISPATCH)
+    EXPECT_TRUE(features.bmi2);
+#endif
+#if defined(__F16C__) && defined(ENDIAN_RUNTIME_DISPATCH)
+    EXPECT_TRUE(features.f16c);
+#endif
+
+    EXPECT_EQ(features.avx512bw, level == endian::cpu_level::avx512bw);
+    EXPECT_LE(endian::active_cpu_level(), level);
+}
+
+TEST(test_cpu_features, names)
+{
+    EXPECT_EQ("scalar", std::string(endian::cpu_level_name(
+                            endian::cpu_level::scalar)));
+    EXPECT_EQ("sse2",
+              std::string(endian::cpu_level_name(endian::cpu_level::sse2)));
+    EXPECT_EQ("ssse3",
+              std::string(endian::cpu_level_name(endian::cpu_level::ssse3)));
+    EXPECT_EQ("avx2",
+              std::string(endian::cpu_level_name(endian::cpu_level::avx2)));
+    EXPECT_EQ("avx512bw", std::string(endian::cpu_level_name(
+                              endian::cpu_level::avx512bw)));
+}
+
+TEST(test_cpu_features, every_level)
+{
+    const endian::cpu_level detected = endian::detected_cpu_level();
+    for (int i = 0; i <= static_cast<int>(endian::cpu_level::avx512bw); ++i)
+    {
+        const auto level = static_cast<endian::cpu_level>(i);
+        SCOPED_TRACE(endian::cpu_level_name(level));
+
+        // Levels the CPU does not support are lowered to the detected level
+        endian::set_cpu_level(level);
+        EXPECT_EQ(level <= detected ? level : detected,
+                  endian::active_cpu_level());
+        check_kernels();
+    }
+
+    endian::reset_cpu_level();
+    check_kernels();
+}
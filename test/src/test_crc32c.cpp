@@ -0,0 +1,225 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/crc32c.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/cpu_features.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/stream_writer.hpp>
+#include <endian/throw_check.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+std::vector<uint8_t> make_data(std::size_t size)
+{
+    std::vector<uint8_t> data(size);
+    uint32_t state = 2463534242U;
+    for (auto& byte : data)
+    {
+        state ^= state << 13;
+        state ^= state >> 17;
+        state ^= state << 5;
+        byte = static_cast<uint8_t>(state);
+    }
+    return data;
+}
+}
+
+TEST(test_crc32c, known_values)
+{
+    for (int i = 0; i <= static_cast<int>(endian::cpu_level::avx512bw); ++i)
+    {
+        const auto level = static_cast<endian::cpu_level>(i);
+        SCOPED_TRACE(endian::cpu_level_name(level));
+        endian::set_cpu_level(level);
+
+        // The check values of RFC 3720 and the CRC catalogue
+        const char* digits = "123456789";
+        EXPECT_EQ(0xE3069283U,
+                  endian::crc32c(reinterpret_cast<const uint8_t*>(digits), 9));
+
+        std::vector<uint8_t> data(32, 0x00);
+        EXPECT_EQ(0x8A9136AAU, endian::crc32c(data.data(), data.size()));
+        data.assign(32, 0xFF);
+        EXPECT_EQ(0x62A8AB43U, endian::crc32c(data.data(), data.size()));
+
+        EXPECT_EQ(0U, endian::crc32c(nullptr, 0));
+    }
+    endian::reset_cpu_level();
+}
+
+TEST(test_crc32c, continued)
+{
+    const std::vector<uint8_t> data = make_data(5000);
+
+    endian::set_cpu_level(endian::cpu_level::scalar);
+    const uint32_t expected = endian::crc32c(data.data(), data.size());
+
+    for (int i = 0; i <= static_cast<int>(endian::cpu_level::avx512bw); ++i)
+    {
+        const auto level = static_cast<endian::cpu_level>(i);
+        SCOPED_TRACE(endian::cpu_level_name(level));
+        endian::set_cpu_level(level);
+
+        EXPECT_EQ(expected, endian::crc32c(data.data(), data.size()));
+
+        // Any split of the data gives the same checksum
+        for (std::size_t split :
+             {0U, 1U, 7U, 8U, 13U, 767U, 768U, 2305U, 4999U, 5000U})
+        {
+            const uint32_t first = endian::crc32c(data.data(), split);
+            EXPECT_EQ(expected, endian::crc32c(data.data() + split,
+                                               data.size() - split, first));
+        }
+    }
+    endian::reset_cpu_level();
+}
+
+TEST(test_crc32c, stream)
+{
+    std::vector<uint8_t> buffer(64);
+    const std::vector<uint8_t> blob = make_data(13);
+
+    endian::stream_writer<endian::big_endian, endian::assert_check,
+                          endian::crc32c_checksum>
+        writer(buffer.data(), buffer.size());
+    writer.write<uint32_t>(0x11223344U);
+    writer.write_bytes<3>(0x556677U);
+    writer.write(blob.data(), blob.size());
+    writer.skip(2);
+    writer.write_varint<uint32_t>(300);
+    writer.write_checksum();
+
+    // The checksum covers the bytes of the message as they are in the buffer
+    const std::size_t message_size = 4 + 3 + 13 + 2 + 2;
+    EXPECT_EQ(message_size + 4, writer.position());
+    EXPECT_EQ(endian::crc32c(buffer.data(), message_size),
+              endian::big_endian::get<uint32_t>(buffer.data() + message_size));
+
+    // A second message starts a new checksum
+    writer.write<uint16_t>(0xABCD);
+    writer.write_checksum();
+    EXPECT_EQ(endian::crc32c(buffer.data() + message_size + 4, 2),
+              endian::big_endian::get<uint32_t>(buffer.data() + message_size +
+                                                6));
+
+    endian::stream_reader<endian::big_endian, endian::assert_check,
+                          endian::crc32c_checksum>
+        reader(buffer.data(), writer.position());
+    EXPECT_EQ(0x11223344U, reader.read<uint32_t>());
+    uint32_t value = 0;
+    reader.read_bytes<3>(value);
+    EXPECT_EQ(0x556677U, value);
+    std::vector<uint8_t> read_blob(blob.size());
+    reader.read(read_blob.data(), read_blob.size());
+    EXPECT_EQ(blob, read_blob);
+    reader.skip(2);
+    EXPECT_EQ(300U, reader.read_varint<uint32_t>());
+    EXPECT_TRUE(reader.verify_checksum());
+
+    EXPECT_EQ(0xABCDU, reader.read<uint16_t>());
+    EXPECT_TRUE(reader.verify_checksum());
+    EXPECT_EQ(0U, reader.remaining_size());
+}
+
+TEST(test_crc32c, long_stream)
+{
+    // Longer than a batch, so the bytes are folded in several runs
+    const std::vector<uint8_t> blob = make_data(3000);
+    std::vector<uint8_t> buffer(4 * (blob.size() + 4) + 4);
+
+    endian::stream_writer<endian::little_endian, endian::assert_check,
+                          endian::crc32c_checksum>
+        writer(buffer.data(), buffer.size());
+    for (uint32_t i = 0; i < 4; ++i)
+    {
+        writer.write(i);
+        writer.write(blob.data(), blob.size());
+    }
+    EXPECT_EQ(endian::crc32c(buffer.data(), writer.position()),
+              writer.checksum());
+    writer.write_checksum();
+
+    endian::stream_reader<endian::little_endian, endian::assert_check,
+                          endian::crc32c_checksum>
+        reader(buffer.data(), buffer.size());
+    reader.skip(buffer.size() - 4);
+    EXPECT_TRUE(reader.verify_checksum());
+}
+
+TEST(test_crc32c, backpatch)
+{
+    // The bytes are counted as they were written, whether or not they were
+    // still collected in a run when the stream seeks back
+    for (std::size_t payload_size : {16U, 5000U})
+    {
+        SCOPED_TRACE(payload_size);
+        const std::vector<uint8_t> payload = make_data(payload_size);
+        std::vector<uint8_t> buffer(payload_size + 4);
+
+        endian::stream_writer<endian::big_endian, endian::assert_check,
+                              endian::crc32c_checksum>
+            writer(buffer.data(), buffer.size());
+        writer.write<uint32_t>(0);
+        writer.write(payload.data(), payload.size());
+        writer.seek(0);
+        writer.write<uint32_t>(static_cast<uint32_t>(payload_size));
+        writer.seek(buffer.size());
+
+        const uint8_t old_length[4] = {0, 0, 0, 0};
+        uint32_t expected = endian::crc32c(old_length, 4);
+        expected = endian::crc32c(payload.data(), payload.size(), expected);
+        expected = endian::crc32c(buffer.data(), 4, expected);
+        EXPECT_EQ(expected, writer.checksum());
+    }
+}
+
+TEST(test_crc32c, corrupted)
+{
+    std::vector<uint8_t> buffer(32);
+    std::vector<uint64_t> values = {1, 2, 3};
+
+    endian::stream_writer<endian::little_endian, endian::assert_check,
+                          endian::crc32c_checksum>
+        writer(buffer.data(), buffer.size());
+    writer.write_array(values.data(), values.size());
+    writer.write_checksum();
+
+    for (std::size_t i = 0; i < writer.position() * 8; ++i)
+    {
+        std::vector<uint8_t> copy = buffer;
+        copy[i / 8] ^= static_cast<uint8_t>(1U << (i % 8));
+
+        endian::stream_reader<endian::little_endian, endian::assert_check,
+                              endian::crc32c_checksum>
+            reader(copy.data(), copy.size());
+        reader.read_array(values.data(), values.size());
+        EXPECT_FALSE(reader.verify_checksum()) << i;
+    }
+
+    // The checksum is checked against the end of the buffer like any other
+    // read or write
+    uint8_t small[6];
+    endian::stream_writer<endian::little_endian, endian::throw_check,
+                          endian::crc32c_checksum>
+        small_writer(small, sizeof(small));
+    small_writer.write<uint16_t>(1);
+    small_writer.write<uint16_t>(2);
+    EXPECT_THROW(small_writer.write_checksum(), std::out_of_range);
+    EXPECT_EQ(4U, small_writer.position());
+
+    endian::stream_reader<endian::little_endian, endian::throw_check,
+                          endian::crc32c_checksum>
+        small_reader(small, 3);
+    EXPECT_THROW(small_reader.verify_checksum(), std::out_of_range);
+}
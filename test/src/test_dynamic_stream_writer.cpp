@@ -0,0 +1,190 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/dynamic_stream_writer.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <endian/arena_allocator.hpp>
+#include <endian/big_endian.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/monotonic_arena.hpp>
+#include <endian/stream_reader.hpp>
+
+#include <gtest/gtest.h>
+
+template <class EndianType, class Writer>
+static void write_message(Writer& writer, uint32_t elements)
+{
+    writer << (uint8_t)0x11 << (uint16_t)0x2233 << (int32_t)-4;
+    writer.template write_bytes<3>((uint32_t)0x445566U);
+    writer.write_all((uint64_t)elements, 1.5);
+
+    std::vector<uint32_t> values(elements);
+    for (uint32_t i = 0; i < elements; ++i)
+    {
+        values[i] = i * 7;
+    }
+    writer.write_array(values.data(), values.size());
+}
+
+template <class EndianType>
+static void read_message(const uint8_t* data, std::size_t size,
+                         uint32_t elements)
+{
+    endian::stream_reader<EndianType> reader(data, size);
+    EXPECT_EQ(0x11U, reader.template read<uint8_t>());
+    EXPECT_EQ(0x2233U, reader.template read<uint16_t>());
+    EXPECT_EQ(-4, reader.template read<int32_t>());
+    uint32_t three = 0;
+    reader.template read_bytes<3>(three);
+    EXPECT_EQ(0x445566U, three);
+    EXPECT_EQ(elements, reader.template read<uint64_t>());
+    EXPECT_EQ(1.5, reader.template read<double>());
+
+    std::vector<uint32_t> values(elements);
+    reader.read_array(values.data(), values.size());
+    for (uint32_t i = 0; i < elements; ++i)
+    {
+        EXPECT_EQ(i * 7, values[i]);
+    }
+    EXPECT_EQ(0U, reader.remaining_size());
+}
+
+template <class EndianType>
+static void test_grow()
+{
+    endian::dynamic_stream_writer<EndianType> writer;
+    EXPECT_EQ(0U, writer.size());
+    EXPECT_EQ(0U, writer.capacity());
+
+    write_message<EndianType>(writer, 1000);
+    EXPECT_EQ(4026U, writer.size());
+    EXPECT_LE(writer.size(), writer.capacity());
+    read_message<EndianType>(writer.data(), writer.size(), 1000);
+
+    // Resetting keeps the storage
+    const uint8_t* data = writer.data();
+    const std::size_t capacity = writer.capacity();
+    writer.reset();
+    EXPECT_EQ(0U, writer.size());
+    write_message<EndianType>(writer, 10);
+    EXPECT_EQ(data, writer.data());
+    EXPECT_EQ(capacity, writer.capacity());
+    read_message<EndianType>(writer.data(), writer.size(), 10);
+}
+
+TEST(test_dynamic_stream_writer, grow)
+{
+    test_grow<endian::big_endian>();
+    test_grow<endian::little_endian>();
+}
+
+TEST(test_dynamic_stream_writer, self_append)
+{
+    // Appending the written bytes to the stream grows the storage while the
+    // bytes are copied from it
+    endian::dynamic_stream_writer<endian::big_endian> writer;
+    for (uint8_t i = 0; i < 40; ++i)
+    {
+        writer.write<uint8_t>(i);
+    }
+    for (int round = 0; round < 6; ++round)
+    {
+        writer.write(writer.data(), writer.size());
+    }
+    ASSERT_EQ(40U * 64U, writer.size());
+    for (std::size_t i = 0; i < writer.size(); ++i)
+    {
+        ASSERT_EQ(i % 40, writer.data()[i]) << i;
+    }
+
+    // Arrays are converted from the stream itself in the same way
+    endian::dynamic_stream_writer<endian::little_endian> words;
+    words.write<uint32_t>(0x01020304U);
+    for (int round = 0; round < 6; ++round)
+    {
+        const std::size_t elements = words.size() / 4;
+        std::vector<uint32_t> values(elements);
+        memcpy(values.data(), words.data(), words.size());
+        std::vector<uint8_t> expected(words.size());
+        endian::little_endian::put_array(values.data(), elements,
+                                         expected.data());
+
+        words.write_array(reinterpret_cast<const uint32_t*>(words.data()),
+                          elements);
+        ASSERT_EQ(8U * elements, words.size());
+        EXPECT_EQ(0, memcmp(expected.data(), words.data() + 4 * elements,
+                            expected.size()));
+    }
+}
+
+TEST(test_dynamic_stream_writer, initial_buffer)
+{
+    uint8_t buffer[32];
+    endian::dynamic_stream_writer<endian::big_endian> writer(buffer,
+                                                             sizeof(buffer));
+
+    // Writing within the initial buffer does not allocate
+    writer << (uint32_t)0x01020304U;
+    EXPECT_EQ(buffer, writer.data());
+    EXPECT_EQ(1U, buffer[0]);
+
+    // Growing copies the written data to allocated storage
+    write_message<endian::big_endian>(writer, 100);
+    EXPECT_NE(buffer, writer.data());
+    EXPECT_EQ(0x01020304U, endian::big_endian::get<uint32_t>(writer.data()));
+    read_message<endian::big_endian>(writer.data() + 4, writer.size() - 4,
+                                     100);
+}
+
+TEST(test_dynamic_stream_writer, reserve_release)
+{
+    endian::dynamic_stream_writer<endian::little_endian> writer;
+    writer.reserve(100);
+    EXPECT_EQ(100U, writer.capacity());
+    const uint8_t* data = writer.data();
+
+    write_message<endian::little_endian>(writer, 10);
+    EXPECT_EQ(data, writer.data());
+
+    // Moving transfers the storage
+    auto moved = std::move(writer);
+    EXPECT_EQ(nullptr, writer.data());
+    EXPECT_EQ(data, moved.data());
+
+    const std::size_t size = moved.size();
+    const std::size_t capacity = moved.capacity();
+    uint8_t* released = moved.release();
+    EXPECT_EQ(0U, moved.size());
+    EXPECT_EQ(nullptr, moved.data());
+    read_message<endian::little_endian>(released, size, 10);
+    moved.get_allocator().deallocate(released, capacity);
+}
+
+TEST(test_dynamic_stream_writer, arena)
+{
+    endian::monotonic_arena arena(1024);
+    using allocator = endian::arena_allocator<uint8_t>;
+
+    for (uint32_t message = 0; message < 10; ++message)
+    {
+        endian::dynamic_stream_writer<endian::big_endian, allocator> writer(
+            allocator{arena});
+        write_message<endian::big_endian>(writer, 100 + message);
+        read_message<endian::big_endian>(writer.data(), writer.size(),
+                                         100 + message);
+        arena.reset();
+    }
+
+    // Every message after the first reuses the blocks of the arena
+    const std::size_t capacity = arena.capacity();
+    endian::dynamic_stream_writer<endian::big_endian, allocator> writer(
+        allocator{arena});
+    write_message<endian::big_endian>(writer, 100);
+    EXPECT_EQ(capacity, arena.capacity());
+}
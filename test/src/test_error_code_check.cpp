@@ -0,0 +1,68 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/error_code_check.hpp>
+
+#include <cstdint>
+#include <system_error>
+#include <vector>
+
+#include <endian/little_endian.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/stream_writer.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(test_error_code_check, reader)
+{
+    // Only the first 3 bytes are handed to the reader
+    std::vector<uint8_t> buffer = {1, 2, 3, 4, 5, 6, 7, 8};
+    endian::stream_reader<endian::little_endian, endian::error_code_check>
+        reader(buffer.data(), 3);
+
+    EXPECT_EQ(0x0201U, reader.read<uint16_t>());
+    EXPECT_FALSE(reader.has_error());
+
+    // A failed read records the error and leaves the stream unchanged
+    uint32_t value = 0;
+    reader.read(value);
+    EXPECT_TRUE(reader.has_error());
+    EXPECT_EQ(std::errc::result_out_of_range, reader.error());
+    EXPECT_EQ(0U, value);
+    EXPECT_EQ(2U, reader.position());
+
+    EXPECT_EQ(0U, reader.peek<uint16_t>());
+    reader.skip(2);
+    reader.seek(4);
+    EXPECT_EQ(2U, reader.position());
+
+    // The error stays until cleared
+    EXPECT_EQ(3U, reader.read<uint8_t>());
+    EXPECT_TRUE(reader.has_error());
+    reader.clear_error();
+    EXPECT_FALSE(reader.has_error());
+    EXPECT_EQ(std::error_code(), reader.error());
+}
+
+TEST(test_error_code_check, writer)
+{
+    // Only the first 3 bytes are handed to the writer
+    std::vector<uint8_t> buffer(8);
+    endian::stream_writer<endian::little_endian, endian::error_code_check>
+        writer(buffer.data(), 3);
+
+    writer << (uint16_t)0x0201U;
+    EXPECT_FALSE(writer.has_error());
+
+    writer << (uint32_t)0xFFFFFFFFU;
+    EXPECT_TRUE(writer.has_error());
+    EXPECT_EQ(2U, writer.position());
+    EXPECT_EQ(0U, buffer[2]);
+
+    writer.clear_error();
+    writer << (uint8_t)3;
+    EXPECT_FALSE(writer.has_error());
+    EXPECT_EQ(std::vector<uint8_t>({1, 2, 3, 0, 0, 0, 0, 0}), buffer);
+}
@@ -0,0 +1,203 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/float16.hpp>
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/cpu_features.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/stream_writer.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+uint32_t bits(float value)
+{
+    uint32_t result;
+    memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+float from_bits(uint32_t value)
+{
+    float result;
+    memcpy(&result, &value, sizeof(result));
+    return result;
+}
+
+// Floats around the rounding boundaries of both formats, and the special
+// values
+std::vector<float> make_floats()
+{
+    std::vector<float> values = {0.0f,
+                                 -0.0f,
+                                 1.0f,
+                                 -2.5f,
+                                 65504.0f,
+                                 65519.0f,
+                                 65520.0f,
+                                 1e10f,
+                                 std::ldexp(1.0f, -24),
+                                 std::ldexp(1.0f, -25),
+                                 std::ldexp(3.0f, -25),
+                                 std::ldexp(1.0f, -14),
+                                 std::numeric_limits<float>::infinity(),
+                                 -std::numeric_limits<float>::infinity(),
+                                 std::numeric_limits<float>::quiet_NaN(),
+                                 from_bits(0x7F800001),
+                                 from_bits(0xFFC12345),
+                                 std::numeric_limits<float>::max(),
+                                 std::numeric_limits<float>::denorm_min()};
+    uint32_t state = 12345;
+    for (uint32_t i = 0; i < 20000; ++i)
+    {
+        state = state * 1664525 + 1013904223;
+        // Mostly values in the range of binary16, and some of any float
+        const uint32_t value =
+            i % 4 == 0 ? state : 0x30000000 + (state % 0x18000000);
+        values.push_back(from_bits(value ^ (i % 2 == 0 ? 0 : 0x80000000)));
+    }
+    return values;
+}
+
+// Runs the bulk conversions at the active level and compares them with the
+// value by value conversions
+template <class EndianType, class HalfType>
+void check_arrays()
+{
+    // Every binary representation, with an odd count to reach the tails
+    const std::size_t count = 65535;
+    std::vector<uint8_t> buffer(count * 2);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        EndianType::template put<uint16_t>(static_cast<uint16_t>(i),
+                                            buffer.data() + i * 2);
+    }
+    std::vector<float> widened(count);
+    endian::get_widened_array<EndianType, HalfType>(widened.data(), count,
+                                                    buffer.data());
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        const float expected =
+            HalfType::from_bits(static_cast<uint16_t>(i));
+        ASSERT_EQ(bits(expected), bits(widened[i])) << i;
+    }
+
+    const std::vector<float> floats = make_floats();
+    std::vector<uint8_t> narrowed(floats.size() * 2);
+    endian::put_narrowed_array<EndianType, HalfType>(
+        floats.data(), floats.size(), narrowed.data());
+    for (std::size_t i = 0; i < floats.size(); ++i)
+    {
+        const HalfType expected(floats[i]);
+        ASSERT_EQ(expected.bits(), EndianType::template get<uint16_t>(
+                                       narrowed.data() + i * 2))
+            << floats[i];
+    }
+}
+}
+
+TEST(test_float16, convert)
+{
+    EXPECT_EQ(0x3C00U, endian::float16(1.0f).bits());
+    EXPECT_EQ(0xC100U, endian::float16(-2.5f).bits());
+    EXPECT_EQ(0x7BFFU, endian::float16(65504.0f).bits());
+    EXPECT_EQ(0x7BFFU, endian::float16(65519.0f).bits());
+    EXPECT_EQ(0x7C00U, endian::float16(65520.0f).bits());
+    EXPECT_EQ(0x0001U, endian::float16(std::ldexp(1.0f, -24)).bits());
+
+    // Halfway between zero and the smallest subnormal rounds to even
+    EXPECT_EQ(0x0000U, endian::float16(std::ldexp(1.0f, -25)).bits());
+    EXPECT_EQ(0x0002U, endian::float16(std::ldexp(3.0f, -25)).bits());
+    EXPECT_EQ(0x0400U, endian::float16(std::ldexp(1.0f, -14)).bits());
+    EXPECT_EQ(0xFC00U,
+              endian::float16(-std::numeric_limits<float>::infinity()).bits());
+    EXPECT_EQ(0x7E00U,
+              endian::float16(std::numeric_limits<float>::quiet_NaN()).bits());
+
+    // Every value survives a round trip through float, and NaNs stay NaN
+    for (uint32_t i = 0; i <= 0xFFFF; ++i)
+    {
+        const auto half = endian::float16::from_bits(static_cast<uint16_t>(i));
+        const float value = half;
+        if (std::isnan(value))
+        {
+            EXPECT_TRUE((i & 0x7C00) == 0x7C00 && (i & 0x3FF) != 0);
+            EXPECT_TRUE(std::isnan(static_cast<float>(endian::float16(value))));
+            continue;
+        }
+        EXPECT_EQ(i, endian::float16(value).bits());
+    }
+    EXPECT_EQ(std::ldexp(1.0f, -24),
+              static_cast<float>(endian::float16::from_bits(0x0001)));
+}
+
+TEST(test_float16, convert_bfloat16)
+{
+    EXPECT_EQ(0x3F80U, endian::bfloat16(1.0f).bits());
+    EXPECT_EQ(1.0f, static_cast<float>(endian::bfloat16::from_bits(0x3F80)));
+
+    // Rounds to nearest even on the cut mantissa
+    EXPECT_EQ(0x3F80U, endian::bfloat16(from_bits(0x3F808000)).bits());
+    EXPECT_EQ(0x3F82U, endian::bfloat16(from_bits(0x3F818000)).bits());
+    EXPECT_EQ(0x3F81U, endian::bfloat16(from_bits(0x3F808001)).bits());
+    EXPECT_EQ(0x7F80U, endian::bfloat16(from_bits(0x7F7FFFFF)).bits());
+
+    // A NaN with only low payload bits stays NaN
+    EXPECT_EQ(0x7FC0U, endian::bfloat16(from_bits(0x7F800001)).bits());
+}
+
+TEST(test_float16, put_get)
+{
+    uint8_t buffer[2];
+    endian::big_endian::put(endian::float16(1.0f), buffer);
+    EXPECT_EQ(0x3C, buffer[0]);
+    EXPECT_EQ(0x00, buffer[1]);
+    EXPECT_EQ(1.0f, endian::big_endian::get<endian::float16>(buffer));
+
+    endian::little_endian::put(endian::bfloat16(-2.0f), buffer);
+    EXPECT_EQ(0x00, buffer[0]);
+    EXPECT_EQ(0xC0, buffer[1]);
+    EXPECT_EQ(-2.0f, endian::little_endian::get<endian::bfloat16>(buffer));
+
+    uint8_t data[10];
+    endian::stream_writer<endian::big_endian> writer(data, sizeof(data));
+    writer << endian::float16(0.5f);
+    writer.write(endian::bfloat16(3.0f));
+    const endian::float16 halves[3] = {1.0f, 2.0f, -4.0f};
+    writer.write_array(halves, 3);
+
+    endian::stream_reader<endian::big_endian> reader(data, sizeof(data));
+    EXPECT_EQ(0.5f, reader.read<endian::float16>());
+    EXPECT_EQ(3.0f, reader.read<endian::bfloat16>());
+    endian::float16 read[3];
+    reader.read_array(read, 3);
+    EXPECT_EQ(2.0f, read[1]);
+    EXPECT_EQ(0xC400U, read[2].bits());
+}
+
+TEST(test_float16, arrays)
+{
+    for (int i = 0; i <= static_cast<int>(endian::cpu_level::avx512bw); ++i)
+    {
+        const auto level = static_cast<endian::cpu_level>(i);
+        SCOPED_TRACE(endian::cpu_level_name(level));
+        endian::set_cpu_level(level);
+
+        check_arrays<endian::big_endian, endian::float16>();
+        check_arrays<endian::little_endian, endian::float16>();
+        check_arrays<endian::big_endian, endian::bfloat16>();
+        check_arrays<endian::little_endian, endian::bfloat16>();
+    }
+    endian::reset_cpu_level();
+}
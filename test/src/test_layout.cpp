@@ -0,0 +1,98 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/layout.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/little_endian.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+struct version : endian::field<1, uint8_t>
+{
+};
+struct length : endian::field<2, uint16_t>
+{
+};
+struct offset : endian::field<3, uint32_t>
+{
+};
+struct timestamp : endian::field<6, uint64_t>
+{
+};
+struct checksum : endian::field<4, int32_t>
+{
+};
+
+template <class EndianType>
+using header =
+    endian::layout<EndianType, version, length, offset, timestamp, checksum>;
+}
+
+// Offsets and size are compile time constants
+static_assert(header<endian::big_endian>::size() == 16, "");
+static_assert(header<endian::big_endian>::offset<version>() == 0, "");
+static_assert(header<endian::big_endian>::offset<length>() == 1, "");
+static_assert(header<endian::big_endian>::offset<offset>() == 3, "");
+static_assert(header<endian::big_endian>::offset<timestamp>() == 6, "");
+static_assert(header<endian::big_endian>::offset<checksum>() == 12, "");
+static_assert(header<endian::big_endian>::index<checksum>() == 4, "");
+
+template <class EndianType>
+static void test_get_set()
+{
+    using layout = header<EndianType>;
+    std::vector<uint8_t> data(layout::size());
+
+    layout::template set<version>(data.data(), 1);
+    layout::template set<length>(data.data(), 0x1122);
+    layout::template set<offset>(data.data(), 0x334455);
+    layout::template set<timestamp>(data.data(), 0x66778899AABBULL);
+    layout::template set<checksum>(data.data(), -2);
+
+    // Every field is stored exactly as with put_bytes at its offset
+    std::vector<uint8_t> expected(layout::size());
+    EndianType::template put_bytes<1>((uint8_t)1, expected.data());
+    EndianType::template put_bytes<2>((uint16_t)0x1122, expected.data() + 1);
+    EndianType::template put_bytes<3>((uint32_t)0x334455, expected.data() + 3);
+    EndianType::template put_bytes<6>((uint64_t)0x66778899AABBULL,
+                                      expected.data() + 6);
+    EndianType::template put_bytes<4>((int32_t)-2, expected.data() + 12);
+    EXPECT_EQ(expected, data);
+
+    EXPECT_EQ(1U, layout::template get<version>(data.data()));
+    EXPECT_EQ(0x1122U, layout::template get<length>(data.data()));
+    EXPECT_EQ(0x334455U, layout::template get<offset>(data.data()));
+    EXPECT_EQ(0x66778899AABBULL, layout::template get<timestamp>(data.data()));
+    EXPECT_EQ(-2, layout::template get<checksum>(data.data()));
+
+    // Decode and encode the whole record
+    auto record = layout::decode(data.data());
+    EXPECT_EQ(0x1122U, layout::template at<length>(record));
+    EXPECT_EQ(-2, layout::template at<checksum>(record));
+
+    layout::template at<length>(record) = 0x5566;
+    std::vector<uint8_t> encoded(layout::size());
+    layout::encode(record, encoded.data());
+    EXPECT_EQ(0x5566U, layout::template get<length>(encoded.data()));
+    EXPECT_EQ(0x66778899AABBULL,
+              layout::template get<timestamp>(encoded.data()));
+    EXPECT_EQ(layout::decode(encoded.data()), record);
+}
+
+TEST(test_layout, get_set_big_endian)
+{
+    test_get_set<endian::big_endian>();
+}
+
+TEST(test_layout, get_set_little_endian)
+{
+    test_get_set<endian::little_endian>();
+}
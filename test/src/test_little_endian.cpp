@@ -6,8 +6,12 @@
 #include <endian/little_endian.hpp>
 
 #include <cstdint>
+#include <vector>
 
+#include <endian/cpu_features.hpp>
 #include <endian/is_big_endian.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/stream_writer.hpp>
 
 #include <gtest/gtest.h>
 
@@ -414,3 +418,213 @@ TEST(test_little_endian, convert_double)
     out = endian::little_endian::get_bytes<sizeof(out), decltype(out)>(data);
     EXPECT_EQ(input, out);
 }
+
+template <class ValueType>
+static void test_little_array(std::size_t elements)
+{
+    SCOPED_TRACE(testing::Message() << "elements: " << elements);
+
+    std::vector<ValueType> input(elements);
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        input[i] = static_cast<ValueType>(0x0102030405060708ULL * (i + 1));
+    }
+
+    // The bulk conversion must produce the same bytes as converting each
+    // value on its own
+    std::vector<uint8_t> expected(elements * sizeof(ValueType));
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        endian::little_endian::put(input[i],
+                                    expected.data() + i * sizeof(ValueType));
+    }
+
+    std::vector<uint8_t> data(elements * sizeof(ValueType));
+    endian::little_endian::put_array(input.data(), elements, data.data());
+    EXPECT_EQ(expected, data);
+
+    std::vector<ValueType> out(elements);
+    endian::little_endian::get_array(out.data(), elements, data.data());
+    EXPECT_EQ(input, out);
+}
+
+TEST(test_little_endian, convert_array)
+{
+    // Sizes covering empty arrays, scalar tails and full vector blocks
+    for (std::size_t elements : {0U, 1U, 7U, 16U, 33U, 100U, 1027U})
+    {
+        test_little_array<uint8_t>(elements);
+        test_little_array<uint16_t>(elements);
+        test_little_array<int16_t>(elements);
+        test_little_array<uint32_t>(elements);
+        test_little_array<int32_t>(elements);
+        test_little_array<uint64_t>(elements);
+        test_little_array<int64_t>(elements);
+        test_little_array<float>(elements);
+        test_little_array<double>(elements);
+    }
+}
+
+TEST(test_little_endian, convert_signed_integers)
+{
+    // Test 16-bit signed integer
+    {
+        uint8_t data[2];
+        int16_t input = -2;
+
+        endian::little_endian::put(input, data);
+        EXPECT_EQ(0xFEU, data[0]);
+        EXPECT_EQ(0xFFU, data[1]);
+
+        int16_t out = 0;
+        endian::little_endian::get(out, data);
+        EXPECT_EQ(input, out);
+
+        out = endian::little_endian::get_bytes<2, int16_t>(data);
+        EXPECT_EQ(input, out);
+    }
+
+    // Test 32-bit signed integer
+    {
+        uint8_t data[4];
+        int32_t input = -0x11223345;
+
+        endian::little_endian::put(input, data);
+        EXPECT_EQ(0xBBU, data[0]);
+        EXPECT_EQ(0xCCU, data[1]);
+        EXPECT_EQ(0xDDU, data[2]);
+        EXPECT_EQ(0xEEU, data[3]);
+
+        int32_t out = 0;
+        endian::little_endian::get(out, data);
+        EXPECT_EQ(input, out);
+
+        out = endian::little_endian::get_bytes<4, int32_t>(data);
+        EXPECT_EQ(input, out);
+    }
+
+    // Test 64-bit signed integer
+    {
+        uint8_t data[8];
+        int64_t input = -0x1122334455667789LL;
+
+        endian::little_endian::put(input, data);
+        EXPECT_EQ(0x77U, data[0]);
+        EXPECT_EQ(0x88U, data[1]);
+        EXPECT_EQ(0x99U, data[2]);
+        EXPECT_EQ(0xAAU, data[3]);
+        EXPECT_EQ(0xBBU, data[4]);
+        EXPECT_EQ(0xCCU, data[5]);
+        EXPECT_EQ(0xDDU, data[6]);
+        EXPECT_EQ(0xEEU, data[7]);
+
+        int64_t out = 0;
+        endian::little_endian::get(out, data);
+        EXPECT_EQ(input, out);
+
+        out = endian::little_endian::get_bytes<8, int64_t>(data);
+        EXPECT_EQ(input, out);
+    }
+}
+
+#if defined(ENDIAN_INT128)
+namespace
+{
+using uint128_t = endian::detail::uint128_t;
+using int128_t = endian::detail::int128_t;
+
+// Puts and gets a Bytes-sized 128 bit value holding the bytes 1 to Bytes
+template <uint8_t Bytes>
+void test_little_128_bit_bytes()
+{
+    SCOPED_TRACE(testing::Message() << "bytes: " << int{Bytes});
+
+    uint128_t input = 0;
+    for (uint8_t i = 1; i <= Bytes; ++i)
+    {
+        input = (input << 8) | (Bytes + 1 - i);
+    }
+
+    uint8_t data[Bytes];
+    endian::little_endian::put_bytes<Bytes>(input, data);
+    for (uint8_t i = 0; i < Bytes; ++i)
+    {
+        EXPECT_EQ(i + 1U, data[i]);
+    }
+
+    uint128_t out = 0;
+    endian::little_endian::get_bytes<Bytes>(out, data);
+    EXPECT_TRUE(input == out);
+}
+}
+
+TEST(test_little_endian, convert_128_bit_integers)
+{
+    test_little_128_bit_bytes<9>();
+    test_little_128_bit_bytes<10>();
+    test_little_128_bit_bytes<11>();
+    test_little_128_bit_bytes<12>();
+    test_little_128_bit_bytes<13>();
+    test_little_128_bit_bytes<14>();
+    test_little_128_bit_bytes<15>();
+    test_little_128_bit_bytes<16>();
+
+    const uint128_t big_value = (uint128_t(0x0102030405060708ULL) << 64) |
+                                0x090A0B0C0D0E0F10ULL;
+    uint8_t data[16];
+    endian::little_endian::put(big_value, data);
+    EXPECT_TRUE(big_value == endian::little_endian::get<uint128_t>(data));
+
+    const int128_t input = -2;
+    endian::little_endian::put(input, data);
+    EXPECT_EQ(0xFEU, data[0]);
+    EXPECT_EQ(0xFFU, data[15]);
+    EXPECT_TRUE(input == endian::little_endian::get<int128_t>(data));
+    EXPECT_TRUE(input == (endian::little_endian::get_bytes<16, int128_t>(data)));
+
+    // The streams read and write them like any other integer
+    uint8_t buffer[30];
+    endian::stream_writer<endian::little_endian> writer(buffer,
+                                                        sizeof(buffer));
+    writer.write(big_value);
+    writer.write_bytes<14>(uint128_t(0x1122) << 96);
+
+    endian::stream_reader<endian::little_endian> reader(buffer,
+                                                        sizeof(buffer));
+    EXPECT_TRUE(big_value == reader.read<uint128_t>());
+    uint128_t value = 0;
+    reader.read_bytes<14>(value);
+    EXPECT_TRUE((uint128_t(0x1122) << 96) == value);
+    EXPECT_EQ(0U, reader.remaining_size());
+}
+
+TEST(test_little_endian, convert_128_bit_array)
+{
+    const std::size_t elements = 37;
+    std::vector<uint128_t> input(elements);
+    for (std::size_t i = 0; i < elements; ++i)
+    {
+        input[i] = i;
+    }
+
+    for (int i = 0; i <= static_cast<int>(endian::cpu_level::avx512bw); ++i)
+    {
+        const auto level = static_cast<endian::cpu_level>(i);
+        SCOPED_TRACE(endian::cpu_level_name(level));
+        endian::set_cpu_level(level);
+
+        std::vector<uint8_t> data(elements * 16);
+        endian::little_endian::put_array(input.data(), elements, data.data());
+        for (uint32_t j = 0; j < elements; ++j)
+        {
+            EXPECT_EQ(j, data[j * 16]);
+            EXPECT_EQ(0U, data[j * 16 + 15]);
+        }
+
+        std::vector<uint128_t> out(elements);
+        endian::little_endian::get_array(out.data(), elements, data.data());
+        EXPECT_TRUE(input == out);
+    }
+    endian::reset_cpu_level();
+}
+#endif
@@ -0,0 +1,229 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/mapped_file.hpp>
+
+#if defined(__unix__) || defined(__APPLE__)
+
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <endian/big_endian.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/stream_writer.hpp>
+#include <endian/throw_check.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// A temporary file removed again when it goes out of scope
+class temporary_file
+{
+public:
+    explicit temporary_file(const std::vector<uint8_t>& content)
+    {
+        const char* directory = std::getenv("TMPDIR");
+        m_path = std::string(directory ? directory : "/tmp") +
+                 "/endian_mapped_file_XXXXXX";
+        const int fd = mkstemp(&m_path[0]);
+        EXPECT_GE(fd, 0);
+        EXPECT_EQ(static_cast<ssize_t>(content.size()),
+                  write(fd, content.data(), content.size()));
+        close(fd);
+    }
+
+    ~temporary_file()
+    {
+        unlink(m_path.c_str());
+    }
+
+    const std::string& path() const
+    {
+        return m_path;
+    }
+
+private:
+    std::string m_path;
+};
+
+// Records of a 32 bit and a 16 bit big endian value
+std::vector<uint8_t> make_records(uint32_t count)
+{
+    std::vector<uint8_t> content(count * 6);
+    endian::stream_writer<endian::big_endian> writer(content.data(),
+                                                     content.size());
+    for (uint32_t i = 0; i < count; ++i)
+    {
+        writer.write<uint32_t>(i * 100000);
+        writer.write<uint16_t>(static_cast<uint16_t>(i));
+    }
+    return content;
+}
+}
+
+TEST(test_mapped_file, read_whole_file)
+{
+    temporary_file file(make_records(10000));
+
+    endian::map_options options;
+    options.hint = endian::access_hint::sequential;
+    endian::mapped_file mapped(file.path(), options);
+    EXPECT_TRUE(mapped.is_open());
+    EXPECT_EQ(60000U, mapped.file_size());
+    EXPECT_EQ(60000U, mapped.size());
+    EXPECT_EQ(0U, mapped.offset());
+    EXPECT_TRUE(mapped.at_end());
+
+    auto reader = mapped.reader<endian::big_endian>();
+    for (uint32_t i = 0; i < 10000; ++i)
+    {
+        EXPECT_EQ(i * 100000, reader.read<uint32_t>());
+        EXPECT_EQ(i, reader.read<uint16_t>());
+    }
+    EXPECT_EQ(0U, reader.remaining_size());
+
+    // Options which only change how the pages are brought in
+    options.hint = endian::access_hint::random;
+    options.populate = true;
+    options.huge_pages = true;
+    endian::mapped_file populated(file.path(), options);
+    EXPECT_EQ(0, memcmp(mapped.data(), populated.data(), 60000));
+    populated.advise(endian::access_hint::normal);
+}
+
+TEST(test_mapped_file, windows)
+{
+    temporary_file file(make_records(10000));
+
+    // A window which is not a multiple of the record size, so records
+    // straddle the window boundaries and windows start inside pages
+    endian::map_options options;
+    options.window_size = 1001;
+    endian::mapped_file mapped(file.path(), options);
+    EXPECT_EQ(1001U, mapped.size());
+    EXPECT_FALSE(mapped.at_end());
+
+    uint32_t i = 0;
+    while (true)
+    {
+        auto reader = mapped.reader<endian::big_endian>();
+        while (reader.remaining_size() >= 6)
+        {
+            EXPECT_EQ(i * 100000, reader.read<uint32_t>());
+            EXPECT_EQ(i, reader.read<uint16_t>());
+            ++i;
+        }
+        if (mapped.at_end())
+        {
+            break;
+        }
+        mapped.map(mapped.offset() + reader.position());
+    }
+    EXPECT_EQ(10000U, i);
+    EXPECT_EQ(60000U, mapped.offset() + mapped.size());
+
+    // A window at an explicit offset and size
+    mapped.map(6 * 5000 + 4, 2);
+    EXPECT_EQ(2U, mapped.size());
+    EXPECT_EQ(5000U, (mapped.reader<endian::big_endian>().read<uint16_t>()));
+
+    // A window at the end of the file is empty
+    mapped.map(60000, 10);
+    EXPECT_EQ(0U, mapped.size());
+    EXPECT_TRUE(mapped.at_end());
+
+    std::error_code error;
+    mapped.map(60001, 10, error);
+    EXPECT_EQ(std::errc::invalid_argument, error);
+}
+
+TEST(test_mapped_file, large_file)
+{
+    if (sizeof(off_t) < 8)
+    {
+        GTEST_SKIP() << "No 64 bit file offsets";
+    }
+
+    // A sparse file larger than 4 GB with a record at the very end
+    temporary_file file(std::vector<uint8_t>{});
+    const uint64_t size = 5ULL * 1024 * 1024 * 1024;
+    {
+        const int fd = open(file.path().c_str(), O_WRONLY);
+        ASSERT_EQ(0, ftruncate(fd, static_cast<off_t>(size)));
+        uint8_t record[6];
+        endian::big_endian::put<uint32_t>(0xAABBCCDDU, record);
+        endian::big_endian::put<uint16_t>(0xEEFFU, record + 4);
+        EXPECT_EQ(6, pwrite(fd, record, 6, static_cast<off_t>(size - 6)));
+        close(fd);
+    }
+
+    endian::map_options options;
+    options.window_size = 1 << 20;
+    endian::mapped_file mapped(file.path(), options);
+    EXPECT_EQ(size, mapped.file_size());
+
+    mapped.map(size - 6);
+    EXPECT_EQ(size - 6, mapped.offset());
+    EXPECT_TRUE(mapped.at_end());
+    auto reader = mapped.reader<endian::big_endian>();
+    EXPECT_EQ(0xAABBCCDDU, reader.read<uint32_t>());
+    EXPECT_EQ(0xEEFFU, reader.read<uint16_t>());
+}
+
+TEST(test_mapped_file, errors)
+{
+    std::error_code error;
+    endian::mapped_file mapped;
+    EXPECT_FALSE(mapped.is_open());
+    mapped.open("/this/file/does/not/exist", error);
+    EXPECT_EQ(std::errc::no_such_file_or_directory, error);
+    EXPECT_FALSE(mapped.is_open());
+
+    EXPECT_THROW(endian::mapped_file("/this/file/does/not/exist"),
+                 std::system_error);
+
+    // Reading past the end of the mapping is caught by the check policy
+    temporary_file file({1, 2, 3});
+    mapped.open(file.path(), error);
+    EXPECT_FALSE(error);
+    auto reader = mapped.reader<endian::little_endian, endian::throw_check>();
+    EXPECT_EQ(0x0201U, reader.read<uint16_t>());
+    EXPECT_THROW(reader.read<uint16_t>(), std::out_of_range);
+}
+
+TEST(test_mapped_file, empty_file_and_move)
+{
+    temporary_file empty(std::vector<uint8_t>{});
+    endian::mapped_file mapped(empty.path());
+    EXPECT_TRUE(mapped.is_open());
+    EXPECT_EQ(0U, mapped.size());
+    EXPECT_EQ(nullptr, mapped.data());
+    EXPECT_TRUE(mapped.at_end());
+    EXPECT_EQ(0U, mapped.reader<endian::big_endian>().remaining_size());
+
+    temporary_file file(make_records(10));
+    endian::mapped_file other(file.path());
+    mapped = std::move(other);
+    EXPECT_FALSE(other.is_open());
+    EXPECT_EQ(60U, mapped.size());
+
+    endian::mapped_file moved(std::move(mapped));
+    EXPECT_FALSE(mapped.is_open());
+    auto reader = moved.reader<endian::big_endian>();
+    reader.skip(6);
+    EXPECT_EQ(100000U, reader.read<uint32_t>());
+    moved.close();
+    EXPECT_FALSE(moved.is_open());
+}
+
+#endif
@@ -0,0 +1,54 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/monotonic_arena.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <endian/arena_allocator.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(test_monotonic_arena, allocate)
+{
+    endian::monotonic_arena arena(64);
+    EXPECT_EQ(0U, arena.capacity());
+
+    uint8_t* a = static_cast<uint8_t*>(arena.allocate(10, 1));
+    uint8_t* b = static_cast<uint8_t*>(arena.allocate(8, 8));
+    EXPECT_EQ(a + 10 <= b, true);
+    EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(b) % 8);
+    EXPECT_EQ(64U, arena.capacity());
+
+    // Larger requests get a block of their own
+    void* c = arena.allocate(100, 16);
+    EXPECT_EQ(0U, reinterpret_cast<uintptr_t>(c) % 16);
+    EXPECT_LT(164U, arena.capacity());
+
+    // Resetting hands out the same memory again
+    const std::size_t capacity = arena.capacity();
+    arena.reset();
+    EXPECT_EQ(a, arena.allocate(10, 1));
+    EXPECT_EQ(b, arena.allocate(8, 8));
+    EXPECT_EQ(c, arena.allocate(100, 16));
+    EXPECT_EQ(capacity, arena.capacity());
+}
+
+TEST(test_monotonic_arena, allocator)
+{
+    endian::monotonic_arena arena;
+    endian::arena_allocator<uint32_t> allocator(arena);
+    endian::arena_allocator<uint8_t> other(allocator);
+    EXPECT_TRUE(allocator == other);
+
+    std::vector<uint32_t, endian::arena_allocator<uint32_t>> values(allocator);
+    for (uint32_t i = 0; i < 100; ++i)
+    {
+        values.push_back(i);
+    }
+    EXPECT_EQ(99U, values.back());
+    EXPECT_EQ(4096U, arena.capacity());
+}
@@ -0,0 +1,90 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/native_endian.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/is_big_endian.hpp>
+#include <endian/little_endian.hpp>
+
+#include <gtest/gtest.h>
+
+// A known host byte order must be usable in constant expressions
+#if defined(ENDIAN_HOST_BYTE_ORDER_KNOWN)
+static_assert(endian::is_big_endian() ==
+                  (endian::host_byte_order == endian::byte_order::big),
+              "is_big_endian() must agree with host_byte_order");
+#endif
+
+TEST(test_native_endian, host_byte_order)
+{
+    EXPECT_EQ(endian::detail::test_is_big_endian(), endian::is_big_endian());
+
+#if defined(__GNUC__) || defined(__clang__) || defined(_MSC_VER)
+    EXPECT_NE(endian::byte_order::unknown, endian::host_byte_order);
+#endif
+}
+
+TEST(test_native_endian, convert)
+{
+    // Full-width values are stored exactly as in memory
+    {
+        uint8_t data[4];
+        uint32_t input = 0x11223344U;
+        endian::native_endian::put(input, data);
+        EXPECT_EQ(0, memcmp(&input, data, sizeof(input)));
+
+        uint32_t out = 0;
+        endian::native_endian::get(out, data);
+        EXPECT_EQ(input, out);
+        EXPECT_EQ(input, endian::native_endian::get<uint32_t>(data));
+    }
+    {
+        uint8_t data[8];
+        double input = 0.1;
+        endian::native_endian::put(input, data);
+        EXPECT_EQ(0, memcmp(&input, data, sizeof(input)));
+        EXPECT_EQ(input, endian::native_endian::get<double>(data));
+    }
+
+    // Odd widths match the conversion of the host byte order
+    {
+        uint8_t data[3];
+        uint8_t expected[3];
+        uint32_t input = 0x112233U;
+        endian::native_endian::put_bytes<3>(input, data);
+        if (endian::is_big_endian())
+        {
+            endian::big_endian::put_bytes<3>(input, expected);
+        }
+        else
+        {
+            endian::little_endian::put_bytes<3>(input, expected);
+        }
+        EXPECT_EQ(0, memcmp(expected, data, sizeof(data)));
+
+        uint32_t out = 0;
+        endian::native_endian::get_bytes<3>(out, data);
+        EXPECT_EQ(input, out);
+        EXPECT_EQ(input,
+                  (endian::native_endian::get_bytes<3, uint32_t>(data)));
+    }
+}
+
+TEST(test_native_endian, convert_array)
+{
+    std::vector<uint32_t> input = {1U, 0x11223344U, 0xFFFFFFFFU};
+    std::vector<uint8_t> data(input.size() * sizeof(uint32_t));
+    endian::native_endian::put_array(input.data(), input.size(), data.data());
+    EXPECT_EQ(0, memcmp(input.data(), data.data(), data.size()));
+
+    std::vector<uint32_t> out(input.size());
+    endian::native_endian::get_array(out.data(), out.size(), data.data());
+    EXPECT_EQ(input, out);
+}
@@ -0,0 +1,141 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/padded_stream_reader.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/native_endian.hpp>
+#include <endian/padded_buffer.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/throw_check.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Reads the whole buffer as Bytes-sized values with both readers and
+// compares the results. The padding is filled with ones, which must never
+// show up in a value.
+template <class EndianType, uint8_t Bytes, class ValueType>
+void check_widths()
+{
+    SCOPED_TRACE(testing::Message() << "bytes: " << int{Bytes});
+
+    const std::size_t count = 37;
+    endian::padded_buffer buffer(count * Bytes);
+    for (std::size_t i = 0; i < buffer.padded_size(); ++i)
+    {
+        buffer.data()[i] =
+            i < buffer.size() ? static_cast<uint8_t>(i * 37 + 11) : 0xFF;
+    }
+
+    endian::stream_reader<EndianType> expected(buffer.data(), buffer.size());
+    endian::padded_stream_reader<EndianType> reader(buffer);
+    for (std::size_t i = 0; i < count; ++i)
+    {
+        ValueType peeked = 0;
+        reader.template peek_bytes<Bytes>(peeked, 0);
+
+        ValueType value = 0;
+        ValueType expected_value = 0;
+        reader.template read_bytes<Bytes>(value);
+        expected.template read_bytes<Bytes>(expected_value);
+        EXPECT_EQ(expected_value, value) << i;
+        EXPECT_EQ(expected_value, peeked) << i;
+    }
+    EXPECT_EQ(0U, reader.remaining_size());
+}
+
+template <class EndianType>
+void check_endian()
+{
+    check_widths<EndianType, 1, uint8_t>();
+    check_widths<EndianType, 2, uint16_t>();
+    check_widths<EndianType, 3, uint32_t>();
+    check_widths<EndianType, 4, uint32_t>();
+    check_widths<EndianType, 5, uint64_t>();
+    check_widths<EndianType, 6, uint64_t>();
+    check_widths<EndianType, 7, uint64_t>();
+    check_widths<EndianType, 8, uint64_t>();
+}
+}
+
+TEST(test_padded_stream_reader, read_bytes)
+{
+    check_endian<endian::big_endian>();
+    check_endian<endian::little_endian>();
+    check_endian<endian::native_endian>();
+}
+
+TEST(test_padded_stream_reader, values)
+{
+    const uint8_t data[] = {0x01, 0x02, 0x03, 0x04, 0x05, 0x06,
+                            0x07, 0x08, 0x09, 0x0A, 0x0B};
+    const endian::padded_buffer buffer(data, sizeof(data));
+    EXPECT_EQ(sizeof(data), buffer.size());
+
+    endian::padded_stream_reader<endian::big_endian> reader(buffer);
+    uint32_t length = 0;
+    reader.read_bytes<3>(length);
+    EXPECT_EQ(0x010203U, length);
+    uint64_t timestamp = 0;
+    reader.peek_bytes<6>(timestamp, 2);
+    EXPECT_EQ(0x060708090A0BULL, timestamp);
+    reader.read_bytes<6>(timestamp);
+    EXPECT_EQ(0x040506070809ULL, timestamp);
+    EXPECT_EQ(0x0A0BU, reader.read<uint16_t>());
+
+    endian::padded_stream_reader<endian::little_endian> little(
+        buffer.data(), buffer.size(), buffer.padded_size());
+    little.read_bytes<3>(length);
+    EXPECT_EQ(0x030201U, length);
+    little.read_bytes<7>(timestamp);
+    EXPECT_EQ(0x0A090807060504ULL, timestamp);
+}
+
+TEST(test_padded_stream_reader, bounds)
+{
+    endian::padded_buffer buffer(5);
+    endian::padded_stream_reader<endian::big_endian, endian::throw_check>
+        reader(buffer);
+
+    uint32_t value = 0;
+    reader.read_bytes<3>(value);
+    EXPECT_THROW(reader.read_bytes<3>(value), std::out_of_range);
+    EXPECT_THROW(reader.peek_bytes<3>(value), std::out_of_range);
+    EXPECT_EQ(3U, reader.position());
+}
+
+TEST(test_padded_stream_reader, padded_buffer)
+{
+    endian::padded_buffer buffer;
+    EXPECT_EQ(0U, buffer.size());
+    EXPECT_EQ(endian::read_padding, buffer.padded_size());
+
+    buffer.resize(10);
+    for (std::size_t i = 0; i < buffer.size(); ++i)
+    {
+        buffer.data()[i] = 0xAB;
+    }
+
+    // Shrinking turns data into padding, which is cleared
+    buffer.resize(4);
+    EXPECT_EQ(4U + endian::read_padding, buffer.padded_size());
+    for (std::size_t i = buffer.size(); i < buffer.padded_size(); ++i)
+    {
+        EXPECT_EQ(0U, buffer.data()[i]);
+    }
+
+    buffer.resize(20);
+    EXPECT_EQ(0xABU, buffer.data()[3]);
+    for (std::size_t i = 4; i < buffer.padded_size(); ++i)
+    {
+        EXPECT_EQ(0U, buffer.data()[i]);
+    }
+}
@@ -0,0 +1,128 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/scatter_gather_writer.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/const_buffer.hpp>
+#include <endian/stream_reader.hpp>
+
+#include <gtest/gtest.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <sys/socket.h>
+#include <unistd.h>
+#endif
+
+namespace
+{
+// Concatenates the buffers of the writer
+template <class Writer>
+std::vector<uint8_t> gather(const Writer& writer)
+{
+    std::vector<endian::const_buffer> buffers;
+    writer.buffers(buffers);
+
+    std::vector<uint8_t> data;
+    for (const endian::const_buffer& b : buffers)
+    {
+        data.insert(data.end(), b.data, b.data + b.size);
+    }
+    return data;
+}
+}
+
+TEST(test_scatter_gather_writer, buffers)
+{
+    std::vector<uint8_t> payload(1000, 0xAB);
+    std::vector<uint8_t> small = {1, 2, 3};
+
+    endian::scatter_gather_writer<endian::big_endian> writer(256);
+    writer << (uint16_t)0x0102 << (uint32_t)payload.size();
+    writer.write(payload.data(), payload.size());
+    writer.write(small.data(), small.size());
+    writer.write_all((uint8_t)4, (uint64_t)5);
+    writer.write(payload.data(), payload.size());
+
+    // Header, payload, trailer and payload again
+    EXPECT_EQ(4U, writer.buffer_count());
+    EXPECT_EQ(2018U, writer.size());
+    EXPECT_EQ(18U, writer.copied_size());
+
+    // The payload is referenced, not copied
+    std::vector<endian::const_buffer> buffers;
+    writer.buffers(buffers);
+    ASSERT_EQ(4U, buffers.size());
+    EXPECT_EQ(6U, buffers[0].size);
+    EXPECT_EQ(payload.data(), buffers[1].data);
+    EXPECT_EQ(12U, buffers[2].size);
+    EXPECT_EQ(payload.data(), buffers[3].data);
+
+    std::vector<uint8_t> data = gather(writer);
+    endian::stream_reader<endian::big_endian> reader(data.data(), data.size());
+    EXPECT_EQ(0x0102U, reader.read<uint16_t>());
+    EXPECT_EQ(1000U, reader.read<uint32_t>());
+    reader.skip(1000);
+    EXPECT_EQ(1U, reader.read<uint8_t>());
+    EXPECT_EQ(2U, reader.read<uint8_t>());
+    EXPECT_EQ(3U, reader.read<uint8_t>());
+    EXPECT_EQ(4U, reader.read<uint8_t>());
+    EXPECT_EQ(5U, reader.read<uint64_t>());
+    EXPECT_EQ(1000U, reader.remaining_size());
+
+    // Resetting empties the stream
+    writer.reset();
+    EXPECT_EQ(0U, writer.size());
+    EXPECT_EQ(0U, writer.buffer_count());
+    writer.write_reference(small.data(), small.size());
+    EXPECT_EQ(small, gather(writer));
+}
+
+#if defined(__unix__) || defined(__APPLE__)
+TEST(test_scatter_gather_writer, writev)
+{
+    std::vector<uint8_t> payload(4000);
+    for (std::size_t i = 0; i < payload.size(); ++i)
+    {
+        payload[i] = (uint8_t)i;
+    }
+
+    endian::scatter_gather_writer<endian::big_endian> writer;
+    writer << (uint32_t)payload.size();
+    writer.write(payload.data(), payload.size());
+    writer << (uint16_t)0xBEEF;
+
+    std::vector<iovec> vectors;
+    writer.iovecs(vectors);
+    ASSERT_EQ(3U, vectors.size());
+
+    int fds[2];
+    ASSERT_EQ(0, socketpair(AF_UNIX, SOCK_STREAM, 0, fds));
+    ASSERT_EQ((ssize_t)writer.size(),
+              writev(fds[0], vectors.data(), (int)vectors.size()));
+
+    std::vector<uint8_t> received(writer.size());
+    std::size_t offset = 0;
+    while (offset < received.size())
+    {
+        ssize_t n = read(fds[1], received.data() + offset,
+                         received.size() - offset);
+        ASSERT_GT(n, 0);
+        offset += (std::size_t)n;
+    }
+    close(fds[0]);
+    close(fds[1]);
+
+    EXPECT_EQ(gather(writer), received);
+    endian::stream_reader<endian::big_endian> reader(received.data(),
+                                                     received.size());
+    EXPECT_EQ(4000U, reader.read<uint32_t>());
+    reader.skip(4000);
+    EXPECT_EQ(0xBEEFU, reader.read<uint16_t>());
+}
+#endif
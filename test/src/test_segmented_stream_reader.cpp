@@ -0,0 +1,163 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/segmented_stream_reader.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/const_buffer.hpp>
+#include <endian/error_code_check.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/stream_writer.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Splits a buffer into segments of the given sizes, repeating the sizes
+// until the buffer is used up. A size of zero gives an empty segment.
+std::vector<endian::const_buffer> split(const std::vector<uint8_t>& buffer,
+                                        const std::vector<std::size_t>& sizes)
+{
+    std::vector<endian::const_buffer> segments;
+    std::size_t offset = 0;
+    for (std::size_t i = 0; offset < buffer.size(); ++i)
+    {
+        std::size_t size =
+            std::min(sizes[i % sizes.size()], buffer.size() - offset);
+        segments.push_back(endian::const_buffer{buffer.data() + offset, size});
+        offset += size;
+    }
+    return segments;
+}
+}
+
+template <class EndianType>
+static void test_read(const std::vector<std::size_t>& sizes)
+{
+    SCOPED_TRACE(testing::Message() << "first size " << sizes[0]);
+
+    std::vector<uint8_t> buffer(64);
+    endian::stream_writer<EndianType> writer(buffer.data(), buffer.size());
+    writer << (uint8_t)0x01 << (uint16_t)0x0203 << (uint32_t)0x04050607
+           << (uint64_t)0x08090A0B0C0D0E0FULL << (int16_t)-2;
+    writer.template write_bytes<3>((uint32_t)0x101112);
+    writer.write_all((uint32_t)0x13141516, (float)2.5);
+    const uint16_t array[4] = {0x1718, 0x191A, 0x1B1C, 0x1D1E};
+    writer.write_array(array, 4);
+    const uint8_t raw[5] = {1, 2, 3, 4, 5};
+    writer.write(raw, sizeof(raw));
+    buffer.resize(writer.position());
+
+    std::vector<endian::const_buffer> segments = split(buffer, sizes);
+    endian::segmented_stream_reader<EndianType> reader(segments);
+    EXPECT_EQ(buffer.size(), reader.size());
+
+    EXPECT_EQ(0x0203U, reader.template peek<uint16_t>(1));
+    EXPECT_EQ(0x01U, reader.template read<uint8_t>());
+    EXPECT_EQ(0x0203U, reader.template read<uint16_t>());
+    EXPECT_EQ(0x04050607U, reader.template read<uint32_t>());
+    EXPECT_EQ(0x08090A0B0C0D0E0FULL, reader.template read<uint64_t>());
+    EXPECT_EQ(-2, reader.template read<int16_t>());
+    uint32_t three = 0;
+    reader.template read_bytes<3>(three);
+    EXPECT_EQ(0x101112U, three);
+
+    uint32_t a = 0;
+    float b = 0;
+    reader.read_all(a, b);
+    EXPECT_EQ(0x13141516U, a);
+    EXPECT_EQ(2.5f, b);
+
+    uint16_t values[4] = {0};
+    reader.read_array(values, 4);
+    for (std::size_t i = 0; i < 4; ++i)
+    {
+        EXPECT_EQ(array[i], values[i]);
+    }
+
+    uint8_t bytes[5] = {0};
+    reader.read(bytes, sizeof(bytes));
+    EXPECT_EQ(0, memcmp(raw, bytes, sizeof(raw)));
+    EXPECT_EQ(0U, reader.remaining_size());
+
+    // Seeking backwards and skipping forwards across segments
+    reader.seek(3);
+    EXPECT_EQ(0x04050607U, reader.template read<uint32_t>());
+    reader.skip(8);
+    EXPECT_EQ(-2, reader.template read<int16_t>());
+    reader.seek(1);
+    EXPECT_EQ(0x0203U, reader.template read<uint16_t>());
+    reader.seek(buffer.size());
+    EXPECT_EQ(0U, reader.remaining_size());
+}
+
+TEST(test_segmented_stream_reader, read)
+{
+    std::vector<std::vector<std::size_t>> splits = {
+        {1000}, {1}, {2}, {3}, {5}, {7}, {0, 3, 0, 1}, {13, 1}, {4, 0, 0, 9}};
+
+    for (const auto& sizes : splits)
+    {
+        test_read<endian::big_endian>(sizes);
+        test_read<endian::little_endian>(sizes);
+    }
+}
+
+TEST(test_segmented_stream_reader, fast_path)
+{
+    std::vector<uint8_t> first = {1, 2, 3, 4};
+    std::vector<uint8_t> second = {5, 6, 7, 8};
+    std::vector<endian::const_buffer> segments = {
+        {first.data(), first.size()}, {second.data(), second.size()}};
+
+    endian::segmented_stream_reader<endian::big_endian> reader(segments);
+    EXPECT_EQ(0U, reader.segment());
+    EXPECT_EQ(0x01020304U, reader.read<uint32_t>());
+    EXPECT_EQ(1U, reader.segment());
+    EXPECT_EQ(0x05060708U, reader.read<uint32_t>());
+    reader.seek(2);
+    EXPECT_EQ(0U, reader.segment());
+    EXPECT_EQ(0x03040506U, reader.read<uint32_t>());
+}
+
+TEST(test_segmented_stream_reader, error_code_check)
+{
+    std::vector<uint8_t> first = {1, 2};
+    std::vector<uint8_t> second = {3};
+    std::vector<endian::const_buffer> segments = {
+        {first.data(), first.size()}, {second.data(), second.size()}};
+
+    endian::segmented_stream_reader<endian::little_endian,
+                                    endian::error_code_check>
+        reader(segments);
+
+    uint32_t value = 0;
+    reader.read(value);
+    EXPECT_TRUE(reader.has_error());
+    EXPECT_EQ(0U, reader.position());
+
+    reader.clear_error();
+    reader.peek_bytes<3>(value);
+    EXPECT_EQ(0x030201U, value);
+    reader.skip(3);
+    EXPECT_FALSE(reader.has_error());
+    reader.skip(1);
+    EXPECT_TRUE(reader.has_error());
+    EXPECT_EQ(3U, reader.position());
+}
+
+TEST(test_segmented_stream_reader, empty)
+{
+    endian::segmented_stream_reader<endian::big_endian> reader(nullptr, 0);
+    EXPECT_EQ(0U, reader.size());
+    reader.read(nullptr, 0);
+    reader.seek(0);
+    EXPECT_EQ(0U, reader.position());
+}
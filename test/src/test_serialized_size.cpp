@@ -0,0 +1,24 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/serialized_size.hpp>
+
+#include <cstdint>
+
+#include <gtest/gtest.h>
+
+TEST(test_serialized_size, value)
+{
+    static_assert(endian::serialized_size<>::value == 0, "");
+    static_assert(endian::serialized_size<uint8_t>::value == 1, "");
+    static_assert(
+        endian::serialized_size<uint8_t, uint16_t, uint32_t>::value == 7, "");
+    static_assert(
+        endian::serialized_size<int64_t, float, double, uint8_t>::value == 21,
+        "");
+
+    EXPECT_EQ(15U, (endian::serialized_size<uint64_t, uint32_t, uint16_t,
+                                            uint8_t>::value));
+}
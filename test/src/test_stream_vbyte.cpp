@@ -0,0 +1,118 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/stream_vbyte.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <random>
+#include <system_error>
+#include <vector>
+
+#include <endian/dynamic_stream_writer.hpp>
+#include <endian/error_code_check.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/stream_writer.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(test_stream_vbyte, encoding)
+{
+    const std::vector<uint32_t> values = {1, 256, 65536, 16777216, 0x7F};
+    std::vector<uint8_t> data(endian::stream_vbyte::max_encoded_size(5));
+    const std::size_t size =
+        endian::stream_vbyte::encode(values.data(), values.size(), data.data());
+    data.resize(size);
+
+    const std::vector<uint8_t> expected = {
+        0xE4, 0x00, 0x01, 0x00, 0x01, 0x00, 0x00, 0x01,
+        0x00, 0x00, 0x00, 0x01, 0x7F};
+    EXPECT_EQ(expected, data);
+    EXPECT_EQ(size, endian::stream_vbyte::encoded_size(values.data(), 5));
+    EXPECT_EQ(size, endian::stream_vbyte::encoded_size(data.data(), 5));
+
+    std::vector<uint32_t> decoded(5);
+    EXPECT_EQ(size,
+              endian::stream_vbyte::decode(data.data(), 5, decoded.data()));
+    EXPECT_EQ(values, decoded);
+}
+
+TEST(test_stream_vbyte, round_trip)
+{
+    std::mt19937 engine(7);
+
+    // Every count up to a few full vector iterations, with values of mixed
+    // lengths so that every control byte is likely to occur
+    for (std::size_t count = 0; count < 200; ++count)
+    {
+        std::vector<uint32_t> values(count);
+        for (uint32_t& value : values)
+        {
+            value = engine() >> (8 * (engine() % 4));
+        }
+
+        // Poison the buffer to catch bytes which are not written
+        std::vector<uint8_t> data(
+            endian::stream_vbyte::max_encoded_size(count) + 16, 0xCC);
+        const std::size_t size =
+            endian::stream_vbyte::encode(values.data(), count, data.data());
+        ASSERT_EQ(endian::stream_vbyte::encoded_size(values.data(), count),
+                  size);
+        ASSERT_EQ(size, endian::stream_vbyte::encoded_size(data.data(), count));
+        for (std::size_t i = size; i < data.size(); ++i)
+        {
+            ASSERT_EQ(0xCC, data[i]);
+        }
+
+        // Decode from an exactly sized copy so that reading past the end
+        // is caught by sanitizers
+        std::vector<uint8_t> exact(data.begin(), data.begin() + size);
+        std::vector<uint32_t> decoded(count);
+        ASSERT_EQ(size, endian::stream_vbyte::decode(exact.data(), count,
+                                                     decoded.data()));
+        ASSERT_EQ(values, decoded);
+    }
+}
+
+TEST(test_stream_vbyte, stream)
+{
+    const std::vector<uint32_t> values = {0, 1, 1000, 100000, 0xFFFFFFFF, 3};
+
+    std::vector<uint8_t> buffer(100);
+    endian::stream_writer<endian::little_endian> writer(buffer.data(),
+                                                        buffer.size());
+    writer << (uint16_t)values.size();
+    writer.write_vbyte_array(values.data(), values.size());
+    writer << (uint8_t)0xAA;
+
+    endian::dynamic_stream_writer<endian::little_endian> dynamic;
+    dynamic << (uint16_t)values.size();
+    dynamic.write_vbyte_array(values.data(), values.size());
+    dynamic << (uint8_t)0xAA;
+    ASSERT_EQ(writer.position(), dynamic.size());
+    EXPECT_EQ(0, memcmp(buffer.data(), dynamic.data(), dynamic.size()));
+
+    endian::stream_reader<endian::little_endian> reader(buffer.data(),
+                                                        writer.position());
+    std::vector<uint32_t> decoded(reader.read<uint16_t>());
+    reader.read_vbyte_array(decoded.data(), decoded.size());
+    EXPECT_EQ(values, decoded);
+    EXPECT_EQ(0xAAU, reader.read<uint8_t>());
+    EXPECT_EQ(0U, reader.remaining_size());
+
+    // Missing data is a read over the end
+    endian::stream_reader<endian::little_endian, endian::error_code_check>
+        short_reader(buffer.data() + 2, writer.position() - 4);
+    short_reader.read_vbyte_array(decoded.data(), decoded.size());
+    EXPECT_EQ(std::errc::result_out_of_range, short_reader.error());
+    EXPECT_EQ(0U, short_reader.position());
+
+    // Missing control bytes as well
+    endian::stream_reader<endian::little_endian, endian::error_code_check>
+        control_reader(buffer.data() + 2, 1);
+    control_reader.read_vbyte_array(decoded.data(), decoded.size());
+    EXPECT_EQ(std::errc::result_out_of_range, control_reader.error());
+}
@@ -10,6 +10,7 @@
 
 #include <endian/big_endian.hpp>
 #include <endian/little_endian.hpp>
+#include <endian/native_endian.hpp>
 
 #include <gtest/gtest.h>
 
@@ -98,3 +99,8 @@ TEST(test_stream_writer, basic_api_big_endian)
 {
     test_basic_api<endian::big_endian>();
 }
+
+TEST(test_stream_writer, basic_api_native_endian)
+{
+    test_basic_api<endian::native_endian>();
+}
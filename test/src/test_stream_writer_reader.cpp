@@ -5,6 +5,7 @@
 
 #include <endian/big_endian.hpp>
 #include <endian/little_endian.hpp>
+#include <endian/native_endian.hpp>
 #include <endian/stream_reader.hpp>
 #include <endian/stream_writer.hpp>
 
@@ -377,6 +378,101 @@ static void run_write_read_vector_test()
     }
 }
 
+template <class EndianType>
+static void run_write_read_array_test()
+{
+    const std::size_t size = 1024;
+    std::vector<uint8_t> buffer(size);
+    endian::stream_writer<EndianType> writer(buffer.data(), size);
+
+    std::vector<uint16_t> first(11);
+    std::vector<uint32_t> second(37);
+    std::vector<double> third(5);
+    for (std::size_t i = 0; i < first.size(); ++i)
+    {
+        first[i] = (uint16_t)(i * 0x0101);
+    }
+    for (std::size_t i = 0; i < second.size(); ++i)
+    {
+        second[i] = (uint32_t)(i * 0x01020304);
+    }
+    for (std::size_t i = 0; i < third.size(); ++i)
+    {
+        third[i] = i * 0.5;
+    }
+
+    // Interleave arrays with single values to check the positions
+    writer.template write_bytes<1>((uint8_t)first.size());
+    writer.write_array(first.data(), first.size());
+    writer.write_array(second.data(), second.size());
+    writer.template write_bytes<1>((uint8_t)third.size());
+    writer.write_array(third.data(), third.size());
+    EXPECT_EQ(1 + first.size() * 2 + second.size() * 4 + 1 + third.size() * 8,
+              writer.position());
+
+    endian::stream_reader<EndianType> reader(buffer.data(), size);
+
+    uint8_t length = 0;
+    reader.template read_bytes<1>(length);
+    std::vector<uint16_t> first_out(length);
+    reader.read_array(first_out.data(), first_out.size());
+    EXPECT_EQ(first, first_out);
+
+    std::vector<uint32_t> second_out(second.size());
+    reader.read_array(second_out.data(), second_out.size());
+    EXPECT_EQ(second, second_out);
+
+    reader.template read_bytes<1>(length);
+    std::vector<double> third_out(length);
+    reader.read_array(third_out.data(), third_out.size());
+    EXPECT_EQ(third, third_out);
+    EXPECT_EQ(writer.position(), reader.position());
+
+    // The values must be encoded exactly as with the single value API
+    reader.seek(1);
+    for (std::size_t i = 0; i < first.size(); ++i)
+    {
+        EXPECT_EQ(first[i], reader.template read<uint16_t>());
+    }
+}
+
+template <class EndianType>
+static void run_write_read_all_test()
+{
+    std::vector<uint8_t> buffer(64);
+    endian::stream_writer<EndianType> writer(buffer.data(), buffer.size());
+
+    uint8_t a = 0x11;
+    uint16_t b = 0x2233;
+    int32_t c = -0x44556677;
+    uint64_t d = 0x8899AABBCCDDEEFFULL;
+    double e = 0.25;
+    writer.write_all(a, b, c, d, e);
+    EXPECT_EQ((endian::serialized_size<uint8_t, uint16_t, int32_t, uint64_t,
+                                       double>::value),
+              writer.position());
+
+    // The result must be identical to writing the values one by one
+    std::vector<uint8_t> expected(64);
+    endian::stream_writer<EndianType> single(expected.data(), expected.size());
+    single << a << b << c << d << e;
+    EXPECT_EQ(expected, buffer);
+
+    endian::stream_reader<EndianType> reader(buffer.data(), buffer.size());
+    uint8_t a_out = 0;
+    uint16_t b_out = 0;
+    int32_t c_out = 0;
+    uint64_t d_out = 0;
+    double e_out = 0;
+    reader.read_all(a_out, b_out, c_out, d_out, e_out);
+    EXPECT_EQ(a, a_out);
+    EXPECT_EQ(b, b_out);
+    EXPECT_EQ(c, c_out);
+    EXPECT_EQ(d, d_out);
+    EXPECT_EQ(e, e_out);
+    EXPECT_EQ(writer.position(), reader.position());
+}
+
 template <class EndianType>
 static void test_stream_operators()
 {
@@ -507,6 +603,8 @@ static void test_reader_and_writer_api()
     run_write_peek_and_read_variadic_bytes<EndianType>();
     run_write_and_read_string_test<EndianType>();
     run_write_read_vector_test<EndianType>();
+    run_write_read_array_test<EndianType>();
+    run_write_read_all_test<EndianType>();
     test_stream_operators<EndianType>();
 }
 
@@ -521,4 +619,9 @@ TEST(test_stream_writer_reader, test_reader_and_writer)
         SCOPED_TRACE("little endian");
         test_reader_and_writer_api<endian::little_endian>();
     }
+
+    {
+        SCOPED_TRACE("native endian");
+        test_reader_and_writer_api<endian::native_endian>();
+    }
 }
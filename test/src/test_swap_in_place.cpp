@@ -0,0 +1,167 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/swap_in_place.hpp>
+
+#include <algorithm>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/little_endian.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/stream_writer.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+// Reverses every field of the records one byte at a time
+std::vector<uint8_t> reference_swap(std::vector<uint8_t> data,
+                                    const std::vector<uint8_t>& widths)
+{
+    std::size_t offset = 0;
+    while (offset < data.size())
+    {
+        for (uint8_t width : widths)
+        {
+            std::reverse(data.begin() + offset,
+                         data.begin() + offset + width);
+            offset += width;
+        }
+    }
+    return data;
+}
+
+std::vector<uint8_t> random_bytes(std::size_t size)
+{
+    std::mt19937 engine(size);
+    std::vector<uint8_t> data(size);
+    for (uint8_t& byte : data)
+    {
+        byte = static_cast<uint8_t>(engine());
+    }
+    return data;
+}
+
+// Checks every number of records up to the given count, so both the vector
+// loops and the scalar tails are covered
+void check_records(const std::vector<uint8_t>& widths, std::size_t count)
+{
+    std::size_t record_size = 0;
+    for (uint8_t width : widths)
+    {
+        record_size += width;
+    }
+
+    for (std::size_t records = 0; records <= count; ++records)
+    {
+        auto data = random_bytes(records * record_size);
+        auto expected = reference_swap(data, widths);
+        endian::swap_records_in_place(data.data(), records, widths);
+        EXPECT_EQ(expected, data) << "records: " << records;
+    }
+}
+
+template <uint8_t Bytes>
+void check_bytes(std::size_t count)
+{
+    for (std::size_t elements = 0; elements <= count; ++elements)
+    {
+        auto data = random_bytes(elements * Bytes);
+        auto expected = reference_swap(data, {Bytes});
+        endian::swap_bytes_in_place<Bytes>(data.data(), elements);
+        EXPECT_EQ(expected, data) << "elements: " << elements;
+    }
+}
+}
+
+TEST(test_swap_in_place, values)
+{
+    std::vector<uint32_t> values(100);
+    std::vector<uint8_t> data(values.size() * 4);
+    for (uint32_t i = 0; i < values.size(); ++i)
+    {
+        values[i] = 0x01020304U * i;
+    }
+    endian::big_endian::put_array(values.data(), values.size(), data.data());
+
+    // Converting from big endian to little endian without a copy
+    endian::swap_in_place<uint32_t>(data.data(), values.size());
+    for (uint32_t i = 0; i < values.size(); ++i)
+    {
+        EXPECT_EQ(values[i],
+                  endian::little_endian::get<uint32_t>(data.data() + i * 4));
+    }
+
+    std::vector<double> doubles = {1.5, -2.25, 1e300, 0.0, 3.125};
+    std::vector<uint8_t> buffer(doubles.size() * 8);
+    endian::little_endian::put_array(doubles.data(), doubles.size(),
+                                     buffer.data());
+    endian::swap_in_place<double>(buffer.data(), doubles.size());
+    for (std::size_t i = 0; i < doubles.size(); ++i)
+    {
+        EXPECT_EQ(doubles[i],
+                  endian::big_endian::get<double>(buffer.data() + i * 8));
+    }
+
+    endian::swap_in_place<uint16_t>(nullptr, 0);
+}
+
+TEST(test_swap_in_place, bytes)
+{
+    check_bytes<1>(40);
+    check_bytes<2>(70);
+    check_bytes<3>(40);
+    check_bytes<4>(40);
+    check_bytes<5>(40);
+    check_bytes<6>(40);
+    check_bytes<7>(40);
+    check_bytes<8>(40);
+}
+
+TEST(test_swap_in_place, records)
+{
+    // Records fitting a vector lane once or several times
+    check_records({2, 3}, 40);
+    check_records({4, 2, 1, 8}, 20);
+    check_records({1, 1}, 40);
+    check_records({8, 8}, 20);
+
+    // Records larger than a vector lane
+    check_records({8, 4, 2, 1, 3, 5}, 20);
+}
+
+TEST(test_swap_in_place, convert_stream)
+{
+    const std::vector<uint8_t> widths = {2, 4, 1, 8, 3};
+    std::vector<uint8_t> data(18 * 10);
+
+    endian::stream_writer<endian::big_endian> writer(data.data(), data.size());
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        writer.write<uint16_t>(i);
+        writer.write<uint32_t>(i * 1000);
+        writer.write<uint8_t>(i);
+        writer.write<uint64_t>(i * 1000000000000ULL);
+        writer.write_bytes<3>(i * 10000);
+    }
+
+    endian::swap_records_in_place(data.data(), 10, widths);
+
+    endian::stream_reader<endian::little_endian> reader(data.data(),
+                                                        data.size());
+    for (uint32_t i = 0; i < 10; ++i)
+    {
+        EXPECT_EQ(i, reader.read<uint16_t>());
+        EXPECT_EQ(i * 1000, reader.read<uint32_t>());
+        EXPECT_EQ(i, reader.read<uint8_t>());
+        EXPECT_EQ(i * 1000000000000ULL, reader.read<uint64_t>());
+        uint32_t value = 0;
+        reader.read_bytes<3>(value);
+        EXPECT_EQ(i * 10000, value);
+    }
+}
@@ -0,0 +1,64 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/throw_check.hpp>
+
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/stream_writer.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(test_throw_check, reader)
+{
+    // Only the first 3 bytes are handed to the reader
+    std::vector<uint8_t> buffer = {1, 2, 3, 4, 5, 6, 7, 8};
+    endian::stream_reader<endian::big_endian, endian::throw_check> reader(
+        buffer.data(), 3);
+
+    EXPECT_EQ(0x0102U, reader.read<uint16_t>());
+
+    // A failed read throws and leaves the stream unchanged
+    uint32_t value = 0;
+    EXPECT_THROW(reader.read(value), std::out_of_range);
+    EXPECT_THROW(reader.read_bytes<3>(value), std::out_of_range);
+    EXPECT_THROW(reader.peek<uint16_t>(), std::out_of_range);
+    EXPECT_THROW(reader.peek_bytes<3>(value), std::out_of_range);
+    EXPECT_THROW(reader.read_array(&value, 1), std::out_of_range);
+    EXPECT_THROW(reader.read(buffer.data(), 2), std::out_of_range);
+    EXPECT_THROW(reader.skip(2), std::out_of_range);
+    EXPECT_THROW(reader.seek(4), std::out_of_range);
+    EXPECT_EQ(0U, value);
+    EXPECT_EQ(2U, reader.position());
+
+    EXPECT_EQ(3U, reader.read<uint8_t>());
+    EXPECT_EQ(0U, reader.remaining_size());
+}
+
+TEST(test_throw_check, writer)
+{
+    // Only the first 3 bytes are handed to the writer
+    std::vector<uint8_t> buffer(8);
+    endian::stream_writer<endian::big_endian, endian::throw_check> writer(
+        buffer.data(), 3);
+
+    writer.write((uint16_t)0x0102U);
+
+    // A failed write throws and leaves the stream unchanged
+    uint32_t value = 0xFFFFFFFFU;
+    EXPECT_THROW(writer.write(value), std::out_of_range);
+    EXPECT_THROW(writer.write_bytes<3>(value & 0xFFFFFF), std::out_of_range);
+    EXPECT_THROW(writer.write_array(&value, 1), std::out_of_range);
+    EXPECT_THROW(writer.write((const uint8_t*)&value, 2), std::out_of_range);
+    EXPECT_EQ(2U, writer.position());
+    EXPECT_EQ(0U, buffer[2]);
+
+    writer << (uint8_t)3;
+    EXPECT_EQ(std::vector<uint8_t>({1, 2, 3, 0, 0, 0, 0, 0}), buffer);
+}
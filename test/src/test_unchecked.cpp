@@ -0,0 +1,38 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/unchecked.hpp>
+
+#include <cstdint>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/stream_writer.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(test_unchecked, writer_and_reader)
+{
+    std::vector<uint8_t> buffer(7);
+    endian::stream_writer<endian::big_endian, endian::unchecked> writer(
+        buffer.data(), buffer.size());
+    writer << (uint8_t)1 << (uint16_t)2 << (uint32_t)3;
+    EXPECT_EQ(7U, writer.position());
+
+    endian::stream_reader<endian::big_endian, endian::unchecked> reader(
+        buffer.data(), buffer.size());
+    uint8_t a = 0;
+    uint16_t b = 0;
+    uint32_t c = 0;
+    reader >> a >> b >> c;
+    EXPECT_EQ(1U, a);
+    EXPECT_EQ(2U, b);
+    EXPECT_EQ(3U, c);
+    EXPECT_EQ(0U, reader.remaining_size());
+
+    static_assert(noexcept(reader.read<uint32_t>()),
+                  "Unchecked reads must be noexcept");
+}
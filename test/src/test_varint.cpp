@@ -0,0 +1,130 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <system_error>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/dynamic_stream_writer.hpp>
+#include <endian/error_code_check.hpp>
+#include <endian/segmented_stream_reader.hpp>
+#include <endian/stream_reader.hpp>
+#include <endian/stream_writer.hpp>
+#include <endian/throw_check.hpp>
+
+#include <gtest/gtest.h>
+
+TEST(test_varint, write_read)
+{
+    std::vector<uint8_t> buffer(200);
+    endian::stream_writer<endian::big_endian> writer(buffer.data(),
+                                                     buffer.size());
+    writer.write_varint((uint8_t)200);
+    writer.write_varint((uint16_t)300);
+    writer.write_varint((uint32_t)0xFFFFFFFF);
+    writer.write_varint((uint64_t)0xFFFFFFFFFFFFFFFFULL);
+    writer.write_varint((int8_t)-128);
+    writer.write_varint((int16_t)-1);
+    writer.write_varint((int32_t)std::numeric_limits<int32_t>::min());
+    writer.write_varint((int64_t)std::numeric_limits<int64_t>::max());
+    writer << (uint8_t)0xAA;
+
+    // Known encodings of the first values
+    EXPECT_EQ(0xC8U, buffer[0]);
+    EXPECT_EQ(0x01U, buffer[1]);
+    EXPECT_EQ(0xACU, buffer[2]);
+    EXPECT_EQ(0x02U, buffer[3]);
+    EXPECT_EQ(2U + 2U + 5U + 10U + 2U + 1U + 5U + 10U + 1U,
+              writer.position());
+
+    endian::stream_reader<endian::big_endian> reader(buffer.data(),
+                                                     writer.position());
+    EXPECT_EQ(200U, reader.read_varint<uint8_t>());
+    EXPECT_EQ(300U, reader.read_varint<uint16_t>());
+    EXPECT_EQ(0xFFFFFFFFU, reader.read_varint<uint32_t>());
+    EXPECT_EQ(0xFFFFFFFFFFFFFFFFULL, reader.read_varint<uint64_t>());
+    EXPECT_EQ(-128, reader.read_varint<int8_t>());
+    EXPECT_EQ(-1, reader.read_varint<int16_t>());
+    EXPECT_EQ(std::numeric_limits<int32_t>::min(),
+              reader.read_varint<int32_t>());
+    EXPECT_EQ(std::numeric_limits<int64_t>::max(),
+              reader.read_varint<int64_t>());
+    EXPECT_EQ(0xAAU, reader.read<uint8_t>());
+    EXPECT_EQ(0U, reader.remaining_size());
+
+    // The dynamic writer produces the same bytes
+    endian::dynamic_stream_writer<endian::big_endian> dynamic;
+    dynamic.write_varint((uint8_t)200);
+    dynamic.write_varint((uint16_t)300);
+    ASSERT_EQ(4U, dynamic.size());
+    EXPECT_EQ(0, memcmp(buffer.data(), dynamic.data(), 4));
+
+    // Varints straddling segments
+    for (std::size_t split = 0; split <= writer.position(); ++split)
+    {
+        std::vector<endian::const_buffer> segments = {
+            {buffer.data(), split},
+            {buffer.data() + split, writer.position() - split}};
+        endian::segmented_stream_reader<endian::big_endian> segmented(
+            segments);
+        EXPECT_EQ(200U, segmented.read_varint<uint8_t>());
+        EXPECT_EQ(300U, segmented.read_varint<uint16_t>());
+        EXPECT_EQ(0xFFFFFFFFU, segmented.read_varint<uint32_t>());
+        EXPECT_EQ(0xFFFFFFFFFFFFFFFFULL, segmented.read_varint<uint64_t>());
+        EXPECT_EQ(-128, segmented.read_varint<int8_t>());
+        EXPECT_EQ(-1, segmented.read_varint<int16_t>());
+        EXPECT_EQ(std::numeric_limits<int32_t>::min(),
+                  segmented.read_varint<int32_t>());
+        EXPECT_EQ(std::numeric_limits<int64_t>::max(),
+                  segmented.read_varint<int64_t>());
+        EXPECT_EQ(0xAAU, segmented.read<uint8_t>());
+    }
+}
+
+TEST(test_varint, error_code_check)
+{
+    // A truncated varint is a read over the end. Only the first 2 bytes are
+    // handed to the reader.
+    std::vector<uint8_t> truncated = {0x80, 0x80, 0, 0, 0, 0, 0, 0};
+    endian::stream_reader<endian::big_endian, endian::error_code_check> reader(
+        truncated.data(), 2);
+    EXPECT_EQ(0U, reader.read_varint<uint32_t>());
+    EXPECT_EQ(std::errc::result_out_of_range, reader.error());
+    EXPECT_EQ(0U, reader.position());
+
+    // A value too large for the type is malformed
+    std::vector<uint8_t> large = {0x80, 0x02, 0, 0, 0, 0, 0, 0};
+    endian::stream_reader<endian::big_endian, endian::error_code_check>
+        large_reader(large.data(), 2);
+    EXPECT_EQ(0U, large_reader.read_varint<uint8_t>());
+    EXPECT_EQ(std::errc::illegal_byte_sequence, large_reader.error());
+    large_reader.clear_error();
+    EXPECT_EQ(256U, large_reader.read_varint<uint16_t>());
+    EXPECT_FALSE(large_reader.has_error());
+
+    // Writing past the end
+    std::vector<uint8_t> buffer(8);
+    endian::stream_writer<endian::big_endian, endian::error_code_check> writer(
+        buffer.data(), 2);
+    writer.write_varint((uint32_t)0x4000);
+    EXPECT_EQ(std::errc::result_out_of_range, writer.error());
+    EXPECT_EQ(0U, writer.position());
+}
+
+TEST(test_varint, throw_check)
+{
+    std::vector<uint8_t> overlong(12, 0x80);
+    endian::stream_reader<endian::big_endian, endian::throw_check> reader(
+        overlong.data(), overlong.size());
+    EXPECT_THROW(reader.read_varint<uint64_t>(), std::invalid_argument);
+
+    endian::stream_reader<endian::big_endian, endian::throw_check>
+        truncated_reader(overlong.data(), 5);
+    EXPECT_THROW(truncated_reader.read_varint<uint64_t>(), std::out_of_range);
+}
@@ -0,0 +1,121 @@
+// Copyright (c) Steinwurf ApS 2026.
+// All Rights Reserved
+//
+// Distributed under the "BSD License". See the accompanying LICENSE.rst file.
+
+#include <endian/wire_value.hpp>
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <vector>
+
+#include <endian/big_endian.hpp>
+#include <endian/float16.hpp>
+#include <endian/little_endian.hpp>
+
+#include <gtest/gtest.h>
+
+namespace
+{
+struct header
+{
+    endian::big<uint8_t> version;
+    endian::big<uint16_t> type;
+    endian::big_bytes<uint32_t, 3> length;
+    endian::little<uint64_t> timestamp;
+    endian::little_bytes<uint64_t, 6> sequence;
+    endian::big<int32_t> offset;
+    endian::little<float> scale;
+};
+}
+
+static_assert(sizeof(header) == 1 + 2 + 3 + 8 + 6 + 4 + 4, "");
+static_assert(alignof(header) == 1, "");
+static_assert(std::is_trivially_copyable<header>::value, "");
+static_assert(std::is_trivial<endian::big<uint32_t>>::value, "");
+static_assert(std::is_standard_layout<endian::big<uint32_t>>::value, "");
+static_assert(sizeof(endian::big_bytes<uint64_t, 5>) == 5, "");
+
+TEST(test_wire_value, overlay)
+{
+    std::vector<uint8_t> buffer(sizeof(header) + 1);
+    uint8_t* data = buffer.data() + 1;
+    endian::big_endian::put<uint8_t>(1, data);
+    endian::big_endian::put<uint16_t>(0x0203, data + 1);
+    endian::big_endian::put_bytes<3>((uint32_t)0x040506, data + 3);
+    endian::little_endian::put<uint64_t>(0x0708090A0B0C0D0EULL, data + 6);
+    endian::little_endian::put_bytes<6>((uint64_t)0x0F1011121314ULL, data + 14);
+    endian::big_endian::put<int32_t>(-5, data + 20);
+    endian::little_endian::put<float>(0.5f, data + 24);
+
+    // Reading through an unaligned overlay
+    const header* h = reinterpret_cast<const header*>(data);
+    EXPECT_EQ(1U, h->version);
+    EXPECT_EQ(0x0203U, h->type);
+    EXPECT_EQ(0x040506U, h->length);
+    EXPECT_EQ(0x0708090A0B0C0D0EULL, h->timestamp);
+    EXPECT_EQ(0x0F1011121314ULL, h->sequence);
+    EXPECT_EQ(-5, h->offset);
+    EXPECT_EQ(0.5f, h->scale);
+
+    // Writing through the overlay
+    header* w = reinterpret_cast<header*>(data);
+    w->type = 0xA1A2;
+    w->offset = w->offset + 10;
+    EXPECT_EQ(0xA1A2U, endian::big_endian::get<uint16_t>(data + 1));
+    EXPECT_EQ(5, endian::big_endian::get<int32_t>(data + 20));
+
+    // Copying keeps the wire bytes
+    header copy;
+    memcpy(&copy, data, sizeof(header));
+    EXPECT_EQ(0, memcmp(&copy, data, sizeof(header)));
+    EXPECT_EQ(0x040506U, copy.length.load());
+}
+
+TEST(test_wire_value, value)
+{
+    endian::big<uint32_t> big = 0x01020304U;
+    EXPECT_EQ(1U, big.data()[0]);
+    EXPECT_EQ(4U, big.data()[3]);
+
+    endian::little<uint32_t> little = 0x01020304U;
+    EXPECT_EQ(4U, little.data()[0]);
+    EXPECT_EQ(1U, little.data()[3]);
+
+    // Converting between byte orders goes through the host value
+    endian::little<uint32_t> converted = static_cast<uint32_t>(big);
+    EXPECT_EQ(0, memcmp(converted.data(), little.data(), 4));
+
+    big.store(7);
+    EXPECT_EQ(7U, big.load());
+    EXPECT_EQ(big + 1U, 8U);
+}
+
+TEST(test_wire_value, extended_types)
+{
+    // The half precision and 128 bit types are accepted like by put and get
+    endian::big<endian::float16> half = endian::float16(1.5f);
+    EXPECT_EQ(0x3EU, half.data()[0]);
+    EXPECT_EQ(1.5f, static_cast<float>(half.load()));
+
+    endian::little<endian::bfloat16> brain = endian::bfloat16(-2.0f);
+    EXPECT_EQ(0xC0U, brain.data()[1]);
+    EXPECT_EQ(-2.0f, static_cast<float>(brain.load()));
+
+#if defined(ENDIAN_INT128)
+    using uint128_t = endian::detail::uint128_t;
+    const uint128_t wide =
+        (uint128_t{0x0102030405060708ULL} << 64) | 0x090A0B0C0D0E0F10ULL;
+    endian::big<uint128_t> big = wide;
+    EXPECT_EQ(0x01U, big.data()[0]);
+    EXPECT_EQ(0x10U, big.data()[15]);
+    EXPECT_TRUE(wide == big.load());
+
+    const uint128_t low = wide & ((uint128_t{1} << 96) - 1);
+    endian::little_bytes<uint128_t, 12> narrow = low;
+    EXPECT_EQ(0x10U, narrow.data()[0]);
+    EXPECT_EQ(0x05U, narrow.data()[11]);
+    EXPECT_TRUE(low == narrow.load());
+#endif
+}